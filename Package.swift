@@ -69,6 +69,14 @@ let package = Package(
             name: "MPApplePay",
             dependencies: ["MPCore", "DeviceFingerPrint"]
         ),
+
+        .executableTarget(
+            name: "MPBenchmarks",
+            dependencies: ["CoreMethods", "MPCore", "MPAnalytics"],
+            resources: [
+              .copy("Fixtures")
+            ]
+        ),
         
         
 
@@ -0,0 +1,78 @@
+//
+//  CoreMethods+Prefetch.swift
+//  MercadoPagoSDK
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+import Foundation
+
+extension CoreMethods {
+    /// Warms the SDK caches ahead of user input.
+    ///
+    /// Requests run concurrently and their results are stored in the SDK caches, so the later
+    /// calls to ``identificationTypes()``, ``paymentMethods(bin:mode:)``, ``issuers(bin:paymentMethodID:)``
+    /// and ``installments(amount:bin:mode:)`` return without waiting for the network.
+    ///
+    /// - Call it without a BIN right after `MercadoPagoSDK.initialize` (or when the form appears) to
+    ///   warm identification types and the site ID.
+    /// - Call it again as soon as 6 BIN digits are known to warm payment methods, issuers and,
+    ///   when `amount` is given, installments before the full 8 digits arrive.
+    ///
+    /// # Example
+    /// ```swift
+    /// func cardNumberDidChange(bin: String) {
+    ///     Task { await coreMethods.prefetch(bin: bin, amount: 100) }
+    /// }
+    /// ```
+    ///
+    /// - Parameters:
+    ///   - bin: Known BIN digits. Ignored when fewer than 6 digits are given.
+    ///   - amount: Payment amount used to warm installments.
+    ///   - mode: The processing mode to use (default: .aggregator)
+    ///
+    /// - Note: Failures are ignored and no analytics events are sent; the regular calls still
+    ///         fetch and report errors when needed.
+    public func prefetch(
+        bin: String? = nil,
+        amount: Double? = nil,
+        mode: ProcessingMode = .aggregator
+    ) async {
+        let processingMode = mode.rawValue
+        let bin = bin.map { String($0.prefix(BinMetadataCache.Key.binPrefixLength)) }
+            .flatMap { $0.count >= CoreMethodsRepository.prefetchBinLength ? $0 : nil }
+
+        // Prefetch runs on the background lane so it never delays the requests the user waits on.
+        await RequestPriority.$override.withValue(.background) {
+            await withTaskGroup(of: Void.self) { group in
+                group.addTask {
+                    _ = try? await self.identificationTypeUseCase.getIdentificationTypes()
+                }
+
+                group.addTask {
+                    await self.dependencies.siteIDProvider.prefetchSiteID()
+                }
+
+                guard let bin else { return }
+
+                group.addTask {
+                    let params = PaymentMethodsParams(bin: bin, processingMode: processingMode)
+                    guard let paymentMethod = try? await self.paymentMethodUseCase.getPaymentMethods(params: params).value.first else {
+                        return
+                    }
+
+                    _ = try? await self.issuerUseCase.getIssuers(
+                        params: IssuersParams(bin: bin, paymentMethodID: paymentMethod.id)
+                    )
+                }
+
+                if let amount {
+                    group.addTask {
+                        _ = try? await self.installmentsUseCase.getInstallments(
+                            params: InstallmentsParams(amount: amount, bin: bin, processingMode: processingMode)
+                        )
+                    }
+                }
+            }
+        }
+    }
+}
@@ -3,3 +3,11 @@ import Foundation
 package protocol InputValidation {
     func isValid(_ text: String) -> Bool
 }
+
+/// A validation that can decide from a digit scan, without re-reading the input text.
+///
+/// `PCIFieldState` keeps the scan up to date on every keystroke, so conforming validations
+/// skip re-parsing the whole field.
+protocol DigitScanValidation: InputValidation {
+    func isValid(_ scan: DigitKernel.Scan) -> Bool
+}
@@ -0,0 +1,103 @@
+//
+//  DigitKernel.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+/// Allocation-free digit scanning shared by the PCI field validations.
+///
+/// Every function walks the UTF-8 view of the input in place: no regex, no intermediate
+/// `String`/`Array` and no per-character parsing. Non-digit characters (mask separators)
+/// are skipped.
+///
+/// Example:
+/// ```swift
+/// let scan = DigitKernel.scan("4509 9535 6623 3704")
+/// scan.count      // 16
+/// scan.passesLuhn // true
+/// ```
+enum DigitKernel {
+    /// Result of a single pass over the digits of an input.
+    struct Scan: Equatable {
+        /// Number of ASCII digits found.
+        var count = 0
+
+        /// Luhn checksum of the digits, doubling every second digit from the right.
+        var luhnSum = 0
+
+        /// Whether the digits form a non-empty sequence with a valid Luhn check digit.
+        var passesLuhn: Bool {
+            self.count > 0 && self.luhnSum % 10 == 0
+        }
+    }
+
+    private static let zero = UInt8(ascii: "0")
+    private static let nine = UInt8(ascii: "9")
+
+    /// Returns whether `byte` is an ASCII digit.
+    @inline(__always)
+    static func isDigit(_ byte: UInt8) -> Bool {
+        byte >= self.zero && byte <= self.nine
+    }
+
+    /// Returns the value of an ASCII digit byte.
+    @inline(__always)
+    static func value(of byte: UInt8) -> Int {
+        Int(byte &- self.zero)
+    }
+
+    /// Luhn contribution of a digit in a doubled position.
+    @inline(__always)
+    static func doubled(_ digit: Int) -> Int {
+        let doubled = digit &* 2
+        return doubled > 9 ? doubled &- 9 : doubled
+    }
+
+    /// Counts the digits of `text` and computes their Luhn checksum in one pass from the right.
+    static func scan(_ text: String) -> Scan {
+        self.scan(utf8: text.utf8)
+    }
+
+    /// Counts the digits of `bytes` and computes their Luhn checksum in one pass from the right.
+    static func scan<Bytes: BidirectionalCollection>(utf8 bytes: Bytes) -> Scan where Bytes.Element == UInt8 {
+        var result = Scan()
+
+        for byte in bytes.reversed() where self.isDigit(byte) {
+            let digit = self.value(of: byte)
+            result.luhnSum &+= result.count & 1 == 1 ? self.doubled(digit) : digit
+            result.count &+= 1
+        }
+
+        return result
+    }
+
+    /// Counts the digits of `text`.
+    static func digitCount(_ text: String) -> Int {
+        var count = 0
+        for byte in text.utf8 where self.isDigit(byte) {
+            count &+= 1
+        }
+        return count
+    }
+
+    /// Parses `bytes` as a non-negative decimal number.
+    ///
+    /// - Returns: The value and its number of digits, or `nil` when `bytes` is empty,
+    ///   contains a non-digit or has more than 9 digits.
+    static func parseNumber<Bytes: Collection>(_ bytes: Bytes) -> (value: Int, digits: Int)?
+        where Bytes.Element == UInt8 {
+        var value = 0
+        var digits = 0
+
+        for byte in bytes {
+            guard self.isDigit(byte), digits < 9 else {
+                return nil
+            }
+            value = value &* 10 &+ Int(byte &- self.zero)
+            digits &+= 1
+        }
+
+        return digits > 0 ? (value, digits) : nil
+    }
+}
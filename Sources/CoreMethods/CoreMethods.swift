@@ -40,12 +40,15 @@ public final class CoreMethods: Sendable {
     
     // MARK: Use Cases
     internal let generateTokenUseCase: GenerateCardTokenUseCaseProtocol
-    private let identificationTypeUseCase: IdentificationTypesUseCaseProtocol
-    private let installmentsUseCase: InstallmentsUseCaseProtocol
-    private let paymentMethodUseCase: PaymentMethodUseCaseProtocol
-    private let issuerUseCase: IssuerUseCaseProtocol
+    internal let identificationTypeUseCase: IdentificationTypesUseCaseProtocol
+    internal let installmentsUseCase: InstallmentsUseCaseProtocol
+    internal let paymentMethodUseCase: PaymentMethodUseCaseProtocol
+    internal let issuerUseCase: IssuerUseCaseProtocol
 
-    typealias Dependency = HasAnalytics & HasFingerPrint
+    /// Publishes the catalog values refreshed by the repositories of the use cases.
+    private let revalidator: CatalogRevalidator
+
+    typealias Dependency = HasAnalytics & HasFingerPrint & HasSiteIDProvider
 
     let dependencies: Dependency
     
@@ -62,6 +65,7 @@ public final class CoreMethods: Sendable {
         self.installmentsUseCase = InstallmentsUseCase()
         self.paymentMethodUseCase = PaymentMethodUseCase()
         self.issuerUseCase = IssuerUseCase()
+        self.revalidator = .shared
     }
 
     /// Initializes a new instance of CoreMethods with custom dependencies.
@@ -75,7 +79,8 @@ public final class CoreMethods: Sendable {
         identificationTypeUseCase: IdentificationTypesUseCaseProtocol,
         installmentsUseCase: InstallmentsUseCaseProtocol,
         paymentMethodUseCase: PaymentMethodUseCaseProtocol,
-        issuerUseCase: IssuerUseCaseProtocol
+        issuerUseCase: IssuerUseCaseProtocol,
+        revalidator: CatalogRevalidator = .shared
     ) {
         self.dependencies = dependencies
         self.generateTokenUseCase = generateTokenUseCase
@@ -83,6 +88,7 @@ public final class CoreMethods: Sendable {
         self.installmentsUseCase = installmentsUseCase
         self.paymentMethodUseCase = paymentMethodUseCase
         self.issuerUseCase = issuerUseCase
+        self.revalidator = revalidator
     }
     
     // MARK: Create Token
@@ -285,11 +291,25 @@ public final class CoreMethods: Sendable {
     ///
     /// - Important: Document types are not available for Mexico.
     public func identificationTypes() async throws -> [IdentificationType] {
+        return try await self.identificationTypesResult().value
+    }
+
+    /// Retrieves the supported identification document types together with their age.
+    ///
+    /// A value past its cache lifetime is returned right away with `isStale == true` while a
+    /// fresher one is fetched in the background and published through ``catalogUpdates()``.
+    ///
+    /// - Returns: The identification types and whether they are stale.
+    ///
+    /// - Throws: ``APIClientError/networkError(_:)``: If no usable cached value exists and the request fails.
+    /// - Throws: ``APIClientError/decodingFailed(_:)``: If the API response cannot be properly decoded
+    public func identificationTypesResult() async throws -> CatalogResult<[IdentificationType]> {
         return try await executeWithTracking(
             operation: { try await self.identificationTypeUseCase.getIdentificationTypes() },
             path: AnalyticsPath.identificationTypes,
+            metric: Metric.identificationTypes,
             extractEventData: { result -> IdentificationTypeEventData? in
-                let documents = result?.map { data in
+                let documents = result?.value.map { data in
                     data.name
                 }
 
@@ -327,6 +347,7 @@ public final class CoreMethods: Sendable {
         return try await executeWithTracking(
             operation: { try await self.installmentsUseCase.getInstallments(params: params) },
             path: AnalyticsPath.installments,
+            metric: Metric.installments,
             extractEventData: { result -> InstallmentEventData? in
                 return InstallmentEventData(
                     amount: amount,
@@ -357,6 +378,26 @@ public final class CoreMethods: Sendable {
         bin: String,
         mode: ProcessingMode = .aggregator
     ) async throws -> [PaymentMethod] {
+        return try await self.paymentMethodsResult(bin: bin, mode: mode).value
+    }
+
+    /// Gets available payment methods for a card BIN together with their age.
+    ///
+    /// A value past its cache lifetime is returned right away with `isStale == true` while a
+    /// fresher one is fetched in the background and published through ``catalogUpdates()``.
+    ///
+    /// - Parameters:
+    ///   - bin: Bank Identification Number (first 6-8 digits of card number)
+    ///   - mode: The processing mode to use (default: .aggregator)
+    ///
+    /// - Returns: The payment methods and whether they are stale.
+    ///
+    /// - Throws: ``APIClientError/networkError(_:)``: If no usable cached value exists and the request fails.
+    /// - Throws: ``APIClientError/decodingFailed(_:)``: If the API response cannot be properly decoded
+    public func paymentMethodsResult(
+        bin: String,
+        mode: ProcessingMode = .aggregator
+    ) async throws -> CatalogResult<[PaymentMethod]> {
         let params = PaymentMethodsParams(bin: bin, processingMode: mode.rawValue)
 
         return try await executeWithTracking(
@@ -368,8 +409,9 @@ public final class CoreMethods: Sendable {
                 }
             },
             path: AnalyticsPath.paymentMethods,
+            metric: Metric.paymentMethods,
             extractEventData: { result -> PaymentMethodEventData? in
-                guard let data = result?.first else {
+                guard let data = result?.value.first else {
                     return PaymentMethodEventData()
                 }
 
@@ -419,6 +461,26 @@ public final class CoreMethods: Sendable {
         bin: String,
         paymentMethodID: String
     ) async throws -> [Issuer] {
+        return try await self.issuersResult(bin: bin, paymentMethodID: paymentMethodID).value
+    }
+
+    /// Gets available issuers for a card BIN and payment method together with their age.
+    ///
+    /// A value past its cache lifetime is returned right away with `isStale == true` while a
+    /// fresher one is fetched in the background and published through ``catalogUpdates()``.
+    ///
+    /// - Parameters:
+    ///   - bin: Bank Identification Number (first 6-8 digits of card number)
+    ///   - paymentMethodID: The ID of the payment method (e.g., "visa", "master")
+    ///
+    /// - Returns: The issuers and whether they are stale.
+    ///
+    /// - Throws: ``APIClientError/networkError(_:)``: If no usable cached value exists and the request fails.
+    /// - Throws: ``APIClientError/decodingFailed(_:)``: If the API response cannot be properly decoded
+    public func issuersResult(
+        bin: String,
+        paymentMethodID: String
+    ) async throws -> CatalogResult<[Issuer]> {
         let params = IssuersParams(bin: bin, paymentMethodID: paymentMethodID)
 
         return try await executeWithTracking(
@@ -426,8 +488,9 @@ public final class CoreMethods: Sendable {
                 try await self.issuerUseCase.getIssuers(params: params)
             },
             path: AnalyticsPath.issuers,
+            metric: Metric.issuers,
             extractEventData: { result -> IssuersEventData? in
-                guard let data = result else {
+                guard let data = result?.value else {
                     return IssuersEventData(issuers: [])
                 }
 
@@ -441,6 +504,28 @@ public final class CoreMethods: Sendable {
     }
 }
 
+// MARK: Catalog Updates
+
+public extension CoreMethods {
+    /// Fresher catalog data fetched in the background after a stale value was served.
+    ///
+    /// # Example
+    /// ```swift
+    /// Task {
+    ///     for await update in coreMethods.catalogUpdates() {
+    ///         if case let .paymentMethods(_, methods) = update {
+    ///             showBrand(methods.first)
+    ///         }
+    ///     }
+    /// }
+    /// ```
+    ///
+    /// - Returns: A stream of the updates published from now on. Cancel the iterating task to stop it.
+    func catalogUpdates() -> AsyncStream<CatalogUpdate> {
+        self.revalidator.updates()
+    }
+}
+
 // MARK: Tokenization Method
 internal extension CoreMethods {
     func tokenization(
@@ -468,6 +553,7 @@ internal extension CoreMethods {
                     )
             },
             path: AnalyticsPath.tokenization,
+            metric: Metric.tokenization,
             extractEventData: { _ -> TokenizationEventData? in
                 return TokenizationEventData(
                     isSaveCard: cardID != nil,
@@ -489,20 +575,36 @@ extension CoreMethods {
         static let issuers = "/checkout_api_native/core_methods/issuers"
     }
 
+    /// Names of the `MPMetrics` histograms and `MPTracer` spans timing each public operation.
+    internal enum Metric {
+        static let identificationTypes = "core_methods.identification_types"
+        static let installments = "core_methods.installments"
+        static let paymentMethods = "core_methods.payment_methods"
+        static let tokenization = "core_methods.tokenization"
+        static let issuers = "core_methods.issuers"
+    }
+
     func executeWithTracking<T: Sendable>(
         operation: @Sendable () async throws -> T,
         path: String,
+        metric: String,
         extractEventData: (@Sendable (T?) async -> (any AnalyticsEventData)?)? = nil
     ) async throws -> T {
+        self.dependencies.siteIDProvider.startIfNeeded()
+
         do {
-            let result = try await operation()
+            let result = try await MPTracer.shared.span(metric) {
+                try await MPMetrics.shared.measure(metric) {
+                    try await operation()
+                }
+            }
 
             Task(priority: .low) {
-                let event = await self.dependencies.analytics.trackEvent(path)
+                var event = self.dependencies.analytics.trackEvent(path)
 
                 if let extractEventData,
                    let eventData = await extractEventData(result) {
-                    await event.setEventData(eventData)
+                    event = event.setEventData(eventData)
                 }
 
                 await event.send()
@@ -510,14 +612,20 @@ extension CoreMethods {
 
             return result
         } catch {
+            // Requests failed fast by an open circuit or the rate limiter are reported through
+            // `MercadoPagoSDK.circuitMetrics()`; an error event per keystroke would add load to an outage.
+            if let error = error as? APIClientError, error.isShortCircuited {
+                throw error
+            }
+
             Task(priority: .low) {
-                let event = await self.dependencies.analytics
+                var event = self.dependencies.analytics
                     .trackEvent(path + "/error")
                     .setError("\(error)")
 
                 if let extractEventData,
                    let eventData = await extractEventData(nil) {
-                    await event.setEventData(eventData)
+                    event = event.setEventData(eventData)
                 }
 
                 await event.send()
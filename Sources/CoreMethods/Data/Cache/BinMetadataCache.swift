@@ -0,0 +1,184 @@
+//
+//  BinMetadataCache.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+#if SWIFT_PACKAGE
+    import MPCore
+#endif
+
+/// Two-tier cache for BIN-scoped catalog data (payment methods and issuers).
+///
+/// Mapped values live in an in-memory LRU; the raw response bodies are persisted on disk so they
+/// survive app launches. Entries are keyed by BIN prefix, processing mode and site.
+/// Fresh entries are served without a network call. Stale entries keep their `ETag`,
+/// allowing the repository to revalidate them with `If-None-Match`.
+///
+/// Example:
+/// ```swift
+/// let key = BinMetadataCache.Key(resource: .paymentMethods, bin: "45089010", processingMode: "aggregator", siteID: "MLB")
+/// if let entry = cache.entry(for: key, decode: decodePaymentMethods), entry.isFresh(ttl: cache.timeToLive) {
+///     return entry.value
+/// }
+/// ```
+final class BinMetadataCache: Sendable {
+    /// Identifies a cached catalog response.
+    struct Key: Hashable, Sendable {
+        enum Resource: Hashable, Sendable {
+            case paymentMethods
+            case issuers(paymentMethodID: String)
+        }
+
+        /// Number of BIN digits used to key the cache.
+        static let binPrefixLength = 8
+
+        let resource: Resource
+        let binPrefix: String
+        let processingMode: String
+        let siteID: String
+
+        init(resource: Resource, bin: String, processingMode: String, siteID: String) {
+            self.resource = resource
+            self.binPrefix = String(bin.prefix(Self.binPrefixLength))
+            self.processingMode = processingMode
+            self.siteID = siteID
+        }
+
+        /// File name used by the disk store. Only alphanumerics, `-` and `_` are kept.
+        var fileName: String {
+            let resourceName: String
+            switch self.resource {
+            case .paymentMethods:
+                resourceName = "payment_methods"
+            case let .issuers(paymentMethodID):
+                resourceName = "issuers_\(paymentMethodID)"
+            }
+
+            let rawName = [resourceName, self.binPrefix, self.processingMode, self.siteID].joined(separator: "-")
+            return String(rawName.unicodeScalars.filter {
+                CharacterSet.alphanumerics.contains($0) || $0 == "-" || $0 == "_"
+            })
+        }
+    }
+
+    /// A cached value together with its validation metadata.
+    struct Entry<Value: Sendable>: Sendable {
+        let value: Value
+        let etag: String?
+        let storedAt: Date
+
+        func isFresh(ttl: TimeInterval, now: Date = Date()) -> Bool {
+            now.timeIntervalSince(self.storedAt) < ttl
+        }
+
+        /// Whether the entry may still be served stale while it is revalidated.
+        func isUsable(ttl: TimeInterval, maximumStaleness: TimeInterval, now: Date = Date()) -> Bool {
+            now.timeIntervalSince(self.storedAt) < ttl + maximumStaleness
+        }
+
+        func result(ttl: TimeInterval, now: Date = Date()) -> CatalogResult<Value> {
+            let age = max(now.timeIntervalSince(self.storedAt), 0)
+            return CatalogResult(value: self.value, age: age, isStale: age >= ttl)
+        }
+    }
+
+    /// Shared cache persisted under `Caches/MPBinCache`.
+    static let shared = BinMetadataCache(directory: BinMetadataCache.defaultDirectory)
+
+    /// Time an entry is served without revalidation.
+    let timeToLive: TimeInterval
+
+    private let memory: LRUCache<Key, any Sendable>
+    private let store: BinMetadataDiskStore?
+
+    /// Creates a cache.
+    /// - Parameters:
+    ///   - directory: Directory for the disk tier. Pass `nil` for a memory-only cache.
+    ///   - capacity: Maximum number of entries kept in memory.
+    ///   - timeToLive: Time an entry is served without revalidation. Defaults to 6 hours.
+    init(
+        directory: URL?,
+        capacity: Int = 128,
+        timeToLive: TimeInterval = 6 * 60 * 60
+    ) {
+        self.memory = LRUCache(capacity: capacity)
+        self.store = directory.map { BinMetadataDiskStore(directory: $0) }
+        self.timeToLive = timeToLive
+    }
+
+    /// Returns the entry stored for `key`, loading it from disk into memory when needed.
+    /// - Parameters:
+    ///   - key: The cache key.
+    ///   - decode: Decodes and maps a persisted response body into the cached value.
+    func entry<Value: Sendable>(
+        for key: Key,
+        decode: (Data) throws -> Value
+    ) -> Entry<Value>? {
+        if let entry = self.memory.value(forKey: key) as? Entry<Value> {
+            return entry
+        }
+
+        guard let record = self.store?.read(fileName: key.fileName),
+              let value = try? decode(record.body) else {
+            return nil
+        }
+
+        let entry = Entry(value: value, etag: record.etag, storedAt: record.storedAt)
+        self.memory.setValue(entry, forKey: key)
+        return entry
+    }
+
+    /// Stores a freshly fetched value and its raw response body.
+    @discardableResult
+    func insert<Value: Sendable>(
+        _ value: Value,
+        body: Data,
+        etag: String?,
+        for key: Key,
+        now: Date = Date()
+    ) -> Entry<Value> {
+        let entry = Entry(value: value, etag: etag, storedAt: now)
+        self.memory.setValue(entry, forKey: key)
+        self.store?.write(
+            BinMetadataDiskStore.Record(etag: etag, storedAt: now, body: body),
+            fileName: key.fileName
+        )
+        return entry
+    }
+
+    /// Marks an entry as fresh again after the server answered `304 Not Modified`.
+    @discardableResult
+    func revalidate<Value: Sendable>(
+        _ entry: Entry<Value>,
+        for key: Key,
+        now: Date = Date()
+    ) -> Entry<Value> {
+        let refreshed = Entry(value: entry.value, etag: entry.etag, storedAt: now)
+        self.memory.setValue(refreshed, forKey: key)
+        self.store?.touch(fileName: key.fileName, storedAt: now)
+        return refreshed
+    }
+
+    /// Removes every entry from both tiers.
+    func removeAll() {
+        self.memory.removeAll()
+        self.store?.removeAll()
+    }
+
+    /// Blocks until every pending disk write has completed.
+    func flush() {
+        self.store?.flush()
+    }
+}
+
+private extension BinMetadataCache {
+    static var defaultDirectory: URL? {
+        FileManager.default
+            .urls(for: .cachesDirectory, in: .userDomainMask)
+            .first?
+            .appendingPathComponent("MPBinCache", isDirectory: true)
+    }
+}
@@ -0,0 +1,74 @@
+//
+//  BinMetadataDiskStore.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Disk tier of ``BinMetadataCache``.
+///
+/// Each entry is a small binary property list holding the raw response body and its validators.
+/// All file access goes through a serial utility queue: writes are asynchronous so they stay off
+/// the typing path, while reads are queued behind pending writes to stay consistent.
+final class BinMetadataDiskStore: Sendable {
+    struct Record: Codable, Sendable {
+        let etag: String?
+        let storedAt: Date
+        let body: Data
+    }
+
+    private let directory: URL
+    private let queue = DispatchQueue(label: "com.mercadopago.sdk.bin-cache", qos: .utility)
+
+    init(directory: URL) {
+        self.directory = directory
+    }
+
+    func read(fileName: String) -> Record? {
+        let url = self.directory.appendingPathComponent(fileName)
+
+        return self.queue.sync {
+            guard let data = try? Data(contentsOf: url) else { return nil }
+            return try? PropertyListDecoder().decode(Record.self, from: data)
+        }
+    }
+
+    func write(_ record: Record, fileName: String) {
+        let directory = self.directory
+        let url = directory.appendingPathComponent(fileName)
+
+        self.queue.async {
+            let encoder = PropertyListEncoder()
+            encoder.outputFormat = .binary
+
+            guard let data = try? encoder.encode(record) else { return }
+
+            try? FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+            try? data.write(to: url, options: .atomic)
+        }
+    }
+
+    func touch(fileName: String, storedAt: Date) {
+        guard let record = self.read(fileName: fileName) else { return }
+
+        self.write(
+            Record(etag: record.etag, storedAt: storedAt, body: record.body),
+            fileName: fileName
+        )
+    }
+
+    func removeAll() {
+        let directory = self.directory
+
+        self.queue.async {
+            try? FileManager.default.removeItem(at: directory)
+        }
+    }
+
+    /// Blocks until every pending write has reached the disk.
+    func flush() {
+        self.queue.sync {}
+    }
+}
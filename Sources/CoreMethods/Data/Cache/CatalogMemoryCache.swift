@@ -0,0 +1,126 @@
+//
+//  CatalogMemoryCache.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+#if SWIFT_PACKAGE
+    import MPCore
+#endif
+
+/// In-memory cache for catalog data that is not BIN metadata: identification types and installments.
+///
+/// Filled by regular calls and by `CoreMethods.prefetch(bin:amount:mode:)`, so the call made
+/// once the form needs the data is answered without a round trip.
+///
+/// Example:
+/// ```swift
+/// let cache = CatalogMemoryCache()
+/// cache.identificationTypes.insert(response, for: "MLB")
+/// let cached = cache.identificationTypes.value(for: "MLB")
+/// ```
+final class CatalogMemoryCache: Sendable {
+    /// Identifies an installments response.
+    struct InstallmentsKey: Hashable, Sendable {
+        let amount: Double
+        let binPrefix: String
+        let processingMode: String
+        let siteID: String
+
+        init(amount: Double, bin: String, processingMode: String, siteID: String) {
+            self.amount = amount
+            self.binPrefix = String(bin.prefix(BinMetadataCache.Key.binPrefixLength))
+            self.processingMode = processingMode
+            self.siteID = siteID
+        }
+    }
+
+    /// A fixed-capacity store whose entries expire after `timeToLive`.
+    ///
+    /// Expired entries are kept for `maximumStaleness` more seconds so they can be served
+    /// stale while they are revalidated.
+    final class Store<Key: Hashable & Sendable, Value: Sendable>: Sendable {
+        private struct Entry {
+            let value: Value
+            let storedAt: Date
+        }
+
+        private let entries: LRUCache<Key, Entry>
+        private let timeToLive: TimeInterval
+        private let maximumStaleness: TimeInterval
+
+        init(capacity: Int, timeToLive: TimeInterval, maximumStaleness: TimeInterval = 0) {
+            self.entries = LRUCache(capacity: capacity)
+            self.timeToLive = timeToLive
+            self.maximumStaleness = maximumStaleness
+        }
+
+        /// Returns the value stored for `key` when it has not expired.
+        func value(for key: Key, now: Date = Date()) -> Value? {
+            guard let result = self.result(for: key, now: now), !result.isStale else {
+                return nil
+            }
+            return result.value
+        }
+
+        /// Returns the value stored for `key` with its age, including expired values that are
+        /// still within `maximumStaleness`.
+        func result(for key: Key, now: Date = Date()) -> CatalogResult<Value>? {
+            guard let entry = self.entries.value(forKey: key) else {
+                return nil
+            }
+
+            let age = now.timeIntervalSince(entry.storedAt)
+            guard age < self.timeToLive + self.maximumStaleness else {
+                self.entries.removeValue(forKey: key)
+                return nil
+            }
+
+            return CatalogResult(value: entry.value, age: age, isStale: age >= self.timeToLive)
+        }
+
+        func insert(_ value: Value, for key: Key, now: Date = Date()) {
+            self.entries.setValue(Entry(value: value, storedAt: now), forKey: key)
+        }
+
+        func removeAll() {
+            self.entries.removeAll()
+        }
+    }
+
+    /// Shared cache used by the default repositories.
+    static let shared = CatalogMemoryCache()
+
+    /// Identification types keyed by site ID.
+    let identificationTypes: Store<String, [IdentificationTypesResponse]>
+
+    /// Mapped installments keyed by amount, BIN prefix, processing mode and site.
+    let installments: Store<InstallmentsKey, [Installment]>
+
+    /// Creates a cache.
+    /// - Parameters:
+    ///   - identificationTypesTimeToLive: Lifetime of identification types. Defaults to 24 hours.
+    ///   - installmentsTimeToLive: Lifetime of installments. Defaults to 10 minutes.
+    ///   - policy: How long expired identification types are kept to be served stale.
+    ///     Installments depend on the amount and are never served stale.
+    init(
+        identificationTypesTimeToLive: TimeInterval = 24 * 60 * 60,
+        installmentsTimeToLive: TimeInterval = 10 * 60,
+        policy: CatalogRevalidator.StalenessPolicy = .default
+    ) {
+        self.identificationTypes = Store(
+            capacity: 8,
+            timeToLive: identificationTypesTimeToLive,
+            maximumStaleness: policy.identificationTypes
+        )
+        self.installments = Store(capacity: 32, timeToLive: installmentsTimeToLive)
+    }
+
+    /// Removes every entry.
+    func removeAll() {
+        self.identificationTypes.removeAll()
+        self.installments.removeAll()
+    }
+}
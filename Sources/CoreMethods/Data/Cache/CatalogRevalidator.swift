@@ -0,0 +1,116 @@
+//
+//  CatalogRevalidator.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+#if SWIFT_PACKAGE
+    import MPCore
+#endif
+
+/// Refreshes stale catalog entries in the background and publishes the fresher values.
+///
+/// The repository serves a stale entry right away and hands its refresh to the revalidator.
+/// Concurrent refreshes of the same entry are merged, and refreshes run on the background
+/// request lane so they never delay the requests the user is waiting on.
+///
+/// Example:
+/// ```swift
+/// for await update in CatalogRevalidator.shared.updates() {
+///     if case let .paymentMethods(bin, methods) = update { reload(bin, methods) }
+/// }
+/// ```
+final class CatalogRevalidator: @unchecked Sendable {
+    /// How long past its cache lifetime an entry may still be served, per endpoint.
+    /// Older entries are fetched before returning, as if they were not cached.
+    struct StalenessPolicy: Sendable {
+        let identificationTypes: TimeInterval
+        let paymentMethods: TimeInterval
+        let issuers: TimeInterval
+
+        /// A week for identification types, three days for BIN metadata.
+        static let `default` = StalenessPolicy(
+            identificationTypes: 7 * 24 * 60 * 60,
+            paymentMethods: 3 * 24 * 60 * 60,
+            issuers: 3 * 24 * 60 * 60
+        )
+    }
+
+    /// Shared revalidator used by the default repositories.
+    static let shared = CatalogRevalidator()
+
+    let policy: StalenessPolicy
+
+    private let lock = NSLock()
+    private var inFlight: [AnyHashable: Task<Void, Never>] = [:]
+    private var subscribers: [UUID: AsyncStream<CatalogUpdate>.Continuation] = [:]
+
+    init(policy: StalenessPolicy = .default) {
+        self.policy = policy
+    }
+
+    /// Stream of the values refreshed from now on. The stream ends when its consumer stops iterating.
+    func updates() -> AsyncStream<CatalogUpdate> {
+        AsyncStream { continuation in
+            let id = UUID()
+
+            lock.lock()
+            subscribers[id] = continuation
+            lock.unlock()
+
+            continuation.onTermination = { [weak self] _ in
+                guard let self else { return }
+                self.lock.lock()
+                self.subscribers[id] = nil
+                self.lock.unlock()
+            }
+        }
+    }
+
+    /// Starts `refresh` for the entry identified by `key` unless one is already running.
+    ///
+    /// - Parameter refresh: Fetches the entry; returns the update to publish, or `nil` when the
+    ///   server had nothing newer or the request failed.
+    func revalidate(_ key: AnyHashable, refresh: @escaping @Sendable () async -> CatalogUpdate?) {
+        lock.lock()
+        defer { lock.unlock() }
+
+        guard inFlight[key] == nil else { return }
+
+        inFlight[key] = Task(priority: .utility) { [weak self] in
+            let update = await RequestPriority.$override.withValue(.background) {
+                await refresh()
+            }
+            self?.finish(key, publishing: update)
+        }
+    }
+
+    /// Waits for every running refresh.
+    func waitForRevalidations() async {
+        lock.lock()
+        let tasks = Array(inFlight.values)
+        lock.unlock()
+
+        for task in tasks {
+            await task.value
+        }
+    }
+}
+
+// MARK: - Private Methods
+
+private extension CatalogRevalidator {
+    func finish(_ key: AnyHashable, publishing update: CatalogUpdate?) {
+        lock.lock()
+        inFlight[key] = nil
+        let subscribers = Array(self.subscribers.values)
+        lock.unlock()
+
+        guard let update else { return }
+        for subscriber in subscribers {
+            subscriber.yield(update)
+        }
+    }
+}
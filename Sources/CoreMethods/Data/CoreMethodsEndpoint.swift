@@ -13,6 +13,15 @@ import Foundation
 private enum ConstantsCoreMethods {
     static let baseURLToken = "https://api.mercadopago.com"
     static let baseURLBricks = "https://api.mercadopago.com/cho-off"
+
+    static let jsonHeaders = [
+        "Content-Type": "application/json"
+    ]
+
+    static let tokenHeaders = [
+        "Content-Type": "application/json",
+        "X-Product-id": MPSDKProduct.id
+    ]
 }
 
 /// Endpoints
@@ -70,17 +79,10 @@ extension CoreMethodsEndpoint: RequestEndpoint {
     /// Request headers.
     var headers: [String: String] {
         switch self {
-            
         case .postCardToken:
-            return [
-                "Content-Type": "application/json",
-                "X-Product-id": MPSDKProduct.id
-            ]
-            
+            return ConstantsCoreMethods.tokenHeaders
         default:
-            return [
-                "Content-Type": "application/json"
-            ]
+            return ConstantsCoreMethods.jsonHeaders
         }
     }
 
@@ -119,4 +121,53 @@ extension CoreMethodsEndpoint: RequestEndpoint {
             return nil
         }
     }
+
+    /// Retry policy. Tokenization carries an idempotency key so a retry after a timeout
+    /// cannot create a second token.
+    var retryPolicy: RetryPolicy {
+        switch self {
+        case .postCardToken:
+            return .default.idempotent()
+        case .getIdentificationTypes, .getInstallments, .getPaymentMethods, .getIssuers:
+            return .default
+        }
+    }
+
+    /// Hedging policy. BIN lookups run while the user types, so a stalled connection is raced
+    /// against a second request.
+    var hedgingPolicy: HedgingPolicy? {
+        switch self {
+        case .getInstallments, .getPaymentMethods, .getIssuers:
+            return .default
+        case .postCardToken, .getIdentificationTypes:
+            return nil
+        }
+    }
+
+    /// Scheduler lane. Tokenization runs after the user tapped Pay; lookups run while typing.
+    var priority: RequestPriority {
+        switch self {
+        case .postCardToken:
+            return .critical
+        case .getIdentificationTypes, .getInstallments, .getPaymentMethods, .getIssuers:
+            return .interactive
+        }
+    }
+
+    /// Circuit breaker. Every endpoint has its own circuit, so an outage of the lookups does not
+    /// fail tokenization fast.
+    var circuitBreakerPolicy: CircuitBreakerPolicy? {
+        .default
+    }
+
+    /// Client-side rate limit. Lookups are driven by keystrokes; tokenization is driven by the
+    /// user tapping Pay and is never throttled on the client.
+    var rateLimitPolicy: RateLimitPolicy? {
+        switch self {
+        case .postCardToken:
+            return nil
+        case .getIdentificationTypes, .getInstallments, .getPaymentMethods, .getIssuers:
+            return .default
+        }
+    }
 }
@@ -0,0 +1,69 @@
+//
+//  DecodableModel.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+/// A `Decodable` wrapper that reads JSON straight into a public domain model.
+///
+/// Decoding through a wrapper avoids building an intermediate `*Response` graph
+/// and copying it into the model afterwards.
+package protocol DecodableModel: Decodable {
+    associatedtype Model
+
+    var model: Model { get }
+}
+
+/// Decodes a top-level JSON array of `Element` directly into its models.
+package struct DecodedModelList<Element: DecodableModel>: Decodable {
+    package let models: [Element.Model]
+
+    package init(from decoder: Decoder) throws {
+        var container = try decoder.unkeyedContainer()
+        self.models = try container.decodeModels(Element.self)
+    }
+}
+
+extension DecodedModelList: Sendable where Element.Model: Sendable {}
+
+extension UnkeyedDecodingContainer {
+    /// Decodes the remaining elements of the container into models.
+    mutating func decodeModels<Element: DecodableModel>(_: Element.Type) throws -> [Element.Model] {
+        var models: [Element.Model] = []
+        models.reserveCapacity(self.count ?? 0)
+
+        while !self.isAtEnd {
+            models.append(try self.decode(Element.self).model)
+        }
+
+        return models
+    }
+}
+
+extension KeyedDecodingContainer {
+    /// Decodes the array stored for `key` into models.
+    func decodeModels<Element: DecodableModel>(_ type: Element.Type, forKey key: Key) throws -> [Element.Model] {
+        var container = try self.nestedUnkeyedContainer(forKey: key)
+        return try container.decodeModels(type)
+    }
+
+    /// Decodes the array stored for `key` into models, or returns `nil` when it is absent or `null`.
+    func decodeModelsIfPresent<Element: DecodableModel>(
+        _ type: Element.Type,
+        forKey key: Key
+    ) throws -> [Element.Model]? {
+        guard self.contains(key), try !self.decodeNil(forKey: key) else {
+            return nil
+        }
+        return try self.decodeModels(type, forKey: key)
+    }
+
+    /// Decodes the object stored for `key` into its model, or returns `nil` when it is absent or `null`.
+    func decodeModelIfPresent<Element: DecodableModel>(
+        _ type: Element.Type,
+        forKey key: Key
+    ) throws -> Element.Model? {
+        try self.decodeIfPresent(type, forKey: key)?.model
+    }
+}
@@ -0,0 +1,139 @@
+//
+//  InstallmentDecoding.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+/// Decodes one element of the `/installments` response into ``Installment``.
+package struct DecodedInstallment: DecodableModel {
+    package let model: Installment
+
+    private enum CodingKeys: String, CodingKey {
+        case paymentMethodId = "payment_method_id"
+        case paymentTypeId = "payment_type_id"
+        case thumbnail
+        case issuer
+        case processingMode = "processing_mode"
+        case merchantAccountId = "merchant_account_id"
+        case payerCosts = "payer_costs"
+        case agreements
+    }
+
+    package init(from decoder: Decoder) throws {
+        let container = try decoder.container(keyedBy: CodingKeys.self)
+
+        self.model = try Installment(
+            paymentMethodId: container.decode(String.self, forKey: .paymentMethodId),
+            paymentTypeId: container.decode(String.self, forKey: .paymentTypeId),
+            thumbnail: container.decode(String.self, forKey: .thumbnail),
+            issuer: container.decode(DecodedIssuer.self, forKey: .issuer).model,
+            processingMode: container.decode(String.self, forKey: .processingMode),
+            merchantAccountId: container.decode(String.self, forKey: .merchantAccountId),
+            payerCosts: container.decodeModels(DecodedPayerCost.self, forKey: .payerCosts),
+            agreements: container.decodeModels(DecodedAgreement.self, forKey: .agreements)
+        )
+    }
+}
+
+private struct DecodedIssuer: DecodableModel {
+    let model: Installment.Issuer
+
+    private enum CodingKeys: String, CodingKey {
+        case id
+        case thumbnail
+    }
+
+    init(from decoder: Decoder) throws {
+        let container = try decoder.container(keyedBy: CodingKeys.self)
+
+        self.model = try Installment.Issuer(
+            id: container.decode(String.self, forKey: .id),
+            thumbnail: container.decode(String.self, forKey: .thumbnail)
+        )
+    }
+}
+
+private struct DecodedPayerCost: DecodableModel {
+    let model: Installment.PayerCost
+
+    private enum CodingKeys: String, CodingKey {
+        case installments
+        case installmentAmount = "installment_amount"
+        case installmentRate = "installment_rate"
+        case installmentRateCollector = "installment_rate_collector"
+        case totalAmount = "total_amount"
+        case minAllowedAmount = "min_allowed_amount"
+        case maxAllowedAmount = "max_allowed_amount"
+        case discountRate = "discount_rate"
+        case reimbursementRate = "reimbursement_rate"
+        case labels
+        case paymentMethodOptionId = "payment_method_option_id"
+    }
+
+    init(from decoder: Decoder) throws {
+        let container = try decoder.container(keyedBy: CodingKeys.self)
+        let installments = try container.decode(Int.self, forKey: .installments)
+
+        self.model = try Installment.PayerCost(
+            id: installments,
+            installments: installments,
+            installmentAmount: container.decode(Double.self, forKey: .installmentAmount),
+            installmentRate: container.decode(Double.self, forKey: .installmentRate),
+            installmentRateCollector: container.decode([String].self, forKey: .installmentRateCollector),
+            totalAmount: container.decode(Double.self, forKey: .totalAmount),
+            minAllowedAmount: container.decode(Double.self, forKey: .minAllowedAmount),
+            maxAllowedAmount: container.decode(Double.self, forKey: .maxAllowedAmount),
+            discountRate: container.decode(Double.self, forKey: .discountRate),
+            reimbursementRate: container.decode(Double.self, forKey: .reimbursementRate),
+            labels: container.decode([String].self, forKey: .labels),
+            paymentMethodOptionId: container.decode(String.self, forKey: .paymentMethodOptionId)
+        )
+    }
+}
+
+private struct DecodedAgreement: DecodableModel {
+    let model: Installment.Agreement
+
+    private enum CodingKeys: String, CodingKey {
+        case merchantAccounts = "merchant_accounts"
+        case timeFrame = "time_frame"
+    }
+
+    private enum MerchantAccountKeys: String, CodingKey {
+        case id
+        case paymentMethodOptionId = "payment_method_option_id"
+    }
+
+    private enum TimeFrameKeys: String, CodingKey {
+        case startDate = "start_date"
+        case endDate = "end_date"
+    }
+
+    init(from decoder: Decoder) throws {
+        let container = try decoder.container(keyedBy: CodingKeys.self)
+
+        var accountsContainer = try container.nestedUnkeyedContainer(forKey: .merchantAccounts)
+        var merchantAccounts: [Installment.Agreement.MerchantAccount] = []
+        merchantAccounts.reserveCapacity(accountsContainer.count ?? 0)
+        while !accountsContainer.isAtEnd {
+            let account = try accountsContainer.nestedContainer(keyedBy: MerchantAccountKeys.self)
+            try merchantAccounts.append(
+                Installment.Agreement.MerchantAccount(
+                    id: account.decode(String.self, forKey: .id),
+                    paymentMethodOptionId: account.decode(String.self, forKey: .paymentMethodOptionId)
+                )
+            )
+        }
+
+        let timeFrame = try container.nestedContainer(keyedBy: TimeFrameKeys.self, forKey: .timeFrame)
+
+        self.model = try Installment.Agreement(
+            merchantAccounts: merchantAccounts,
+            timeFrame: Installment.Agreement.TimeFrame(
+                startDate: timeFrame.decode(String.self, forKey: .startDate),
+                endDate: timeFrame.decode(String.self, forKey: .endDate)
+            )
+        )
+    }
+}
@@ -0,0 +1,226 @@
+//
+//  PaymentMethodDecoding.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+#if SWIFT_PACKAGE
+    import MPCore
+#endif
+
+/// Decodes one element of the `/payment_methods/search` response into ``PaymentMethod``.
+package struct DecodedPaymentMethod: DecodableModel {
+    package let model: PaymentMethod
+
+    private enum CodingKeys: String, CodingKey {
+        case id
+        case paymentTypeId = "payment_type_id"
+        case status
+        case processingMode = "processing_mode"
+        case accreditationTime = "accreditation_time"
+        case merchantAccountId = "merchant_account_id"
+        case siteId = "site_id"
+        case thumbnail
+        case minAccreditationDays = "min_accreditation_days"
+        case maxAccreditationDays = "max_accreditation_days"
+        case totalFinancialCost = "total_financial_cost"
+        case financialInstitutions = "financial_institutions"
+        case issuer
+        case card
+        case bins
+        case marketplace
+        case deferredCapture = "deferred_capture"
+        case agreements
+        case payerCosts = "payer_costs"
+        case labels
+        case additionalInfoNeeded = "additional_info_needed"
+    }
+
+    package init(from decoder: Decoder) throws {
+        let container = try decoder.container(keyedBy: CodingKeys.self)
+
+        self.model = try PaymentMethod(
+            id: container.decode(String.self, forKey: .id),
+            paymentTypeId: container.decode(String.self, forKey: .paymentTypeId),
+            status: container.decode(String.self, forKey: .status),
+            processingMode: container.decode(String.self, forKey: .processingMode),
+            accreditationTime: container.decode(Int.self, forKey: .accreditationTime),
+            merchantAccountId: container.decode(String.self, forKey: .merchantAccountId),
+            siteId: container.decode(String.self, forKey: .siteId),
+            thumbnail: container.decodeIfPresent(String.self, forKey: .thumbnail),
+            minAccreditationDays: container.decode(Int.self, forKey: .minAccreditationDays),
+            maxAccreditationDays: container.decode(Int.self, forKey: .maxAccreditationDays),
+            totalFinancialCost: container.decode(Double.self, forKey: .totalFinancialCost),
+            financialInstitution: container.decodeModelsIfPresent(DecodedFinancialInstitution.self, forKey: .financialInstitutions),
+            issuer: container.decodeModelIfPresent(DecodedIssuer.self, forKey: .issuer),
+            card: container.decodeModelIfPresent(DecodedCardInfo.self, forKey: .card),
+            bins: container.decodeIfPresent([Int].self, forKey: .bins),
+            marketplace: container.decodeIfPresent(String.self, forKey: .marketplace),
+            deferredCapture: container.decodeIfPresent(String.self, forKey: .deferredCapture),
+            agreements: container.decodeModelsIfPresent(DecodedAgreement.self, forKey: .agreements),
+            payerCosts: container.decodeModelsIfPresent(DecodedPayerCost.self, forKey: .payerCosts),
+            labels: container.decodeIfPresent([String].self, forKey: .labels),
+            additionalInfoNeeded: container.decodeIfPresent([String].self, forKey: .additionalInfoNeeded)
+        )
+    }
+}
+
+private struct DecodedFinancialInstitution: DecodableModel {
+    let model: PaymentMethod.FinancialInstitution
+
+    private enum CodingKeys: String, CodingKey {
+        case id
+        case description
+    }
+
+    init(from decoder: Decoder) throws {
+        let container = try decoder.container(keyedBy: CodingKeys.self)
+
+        self.model = try PaymentMethod.FinancialInstitution(
+            id: container.decode(String.self, forKey: .id),
+            description: container.decode(String.self, forKey: .description)
+        )
+    }
+}
+
+private struct DecodedIssuer: DecodableModel {
+    let model: PaymentMethod.Issuer
+
+    private enum CodingKeys: String, CodingKey {
+        case id
+        case isDefault = "default"
+        case thumbnail
+    }
+
+    init(from decoder: Decoder) throws {
+        let container = try decoder.container(keyedBy: CodingKeys.self)
+
+        self.model = try PaymentMethod.Issuer(
+            id: container.decode(Int.self, forKey: .id),
+            isDefault: container.decode(Bool.self, forKey: .isDefault),
+            thumbnail: container.decodeIfPresent(String.self, forKey: .thumbnail)
+        )
+    }
+}
+
+private struct DecodedCardInfo: DecodableModel {
+    let model: PaymentMethod.CardInfo
+
+    private enum CodingKeys: String, CodingKey {
+        case bin
+        case length
+        case validation
+        case securityCode = "security_code"
+    }
+
+    private enum LengthKeys: String, CodingKey {
+        case min
+        case max
+    }
+
+    private enum SecurityCodeKeys: String, CodingKey {
+        case mode
+        case location
+        case length
+    }
+
+    init(from decoder: Decoder) throws {
+        let container = try decoder.container(keyedBy: CodingKeys.self)
+        let length = try container.nestedContainer(keyedBy: LengthKeys.self, forKey: .length)
+        let securityCode = try container.nestedContainer(keyedBy: SecurityCodeKeys.self, forKey: .securityCode)
+
+        self.model = try PaymentMethod.CardInfo(
+            bin: container.decode(Int.self, forKey: .bin),
+            length: PaymentMethod.CardInfo.CardLength(
+                min: length.decode(Int.self, forKey: .min),
+                max: length.decode(Int.self, forKey: .max)
+            ),
+            validation: container.decode(String.self, forKey: .validation),
+            securityCode: PaymentMethod.CardInfo.SecurityCode(
+                mode: securityCode.decode(String.self, forKey: .mode),
+                location: securityCode.decode(String.self, forKey: .location),
+                length: securityCode.decode(Int.self, forKey: .length)
+            )
+        )
+    }
+}
+
+private struct DecodedPayerCost: DecodableModel {
+    let model: PaymentMethod.PayerCost
+
+    private enum CodingKeys: String, CodingKey {
+        case installments
+        case installmentRate = "installment_rate"
+        case discountRate = "discount_rate"
+        case reimbursementRate = "reimbursement_rate"
+        case minAllowedAmount = "min_allowed_amount"
+        case maxAllowedAmount = "max_allowed_amount"
+        case paymentMethodOptionId = "payment_method_option_id"
+        case labels
+    }
+
+    init(from decoder: Decoder) throws {
+        let container = try decoder.container(keyedBy: CodingKeys.self)
+
+        self.model = try PaymentMethod.PayerCost(
+            installments: container.decode(Int.self, forKey: .installments),
+            installmentRate: container.decode(Double.self, forKey: .installmentRate),
+            discountRate: container.decode(Double.self, forKey: .discountRate),
+            reimbursementRate: container.decode(Double.self, forKey: .reimbursementRate),
+            minAllowedAmount: container.decode(Double.self, forKey: .minAllowedAmount),
+            maxAllowedAmount: container.decode(Double.self, forKey: .maxAllowedAmount),
+            paymentMethodOptionId: container.decode(String.self, forKey: .paymentMethodOptionId),
+            labels: container.decodeIfPresent([String].self, forKey: .labels)
+        )
+    }
+}
+
+private struct DecodedAgreement: DecodableModel {
+    let model: PaymentMethod.Agreement
+
+    private enum CodingKeys: String, CodingKey {
+        case timeFrame = "time_frame"
+        case merchantAccounts = "merchant_accounts"
+    }
+
+    private enum TimeFrameKeys: String, CodingKey {
+        case startDate = "start_date"
+        case endDate = "end_date"
+    }
+
+    private enum MerchantAccountKeys: String, CodingKey {
+        case id
+        case paymentMethodOptionId = "payment_method_option_id"
+    }
+
+    init(from decoder: Decoder) throws {
+        let container = try decoder.container(keyedBy: CodingKeys.self)
+        let timeFrame = try container.nestedContainer(keyedBy: TimeFrameKeys.self, forKey: .timeFrame)
+        let startDate = try timeFrame.decode(String.self, forKey: .startDate)
+        let endDate = try timeFrame.decode(String.self, forKey: .endDate)
+
+        var accountsContainer = try container.nestedUnkeyedContainer(forKey: .merchantAccounts)
+        var merchantAccounts: [PaymentMethod.Agreement.MerchantAccount] = []
+        merchantAccounts.reserveCapacity(accountsContainer.count ?? 0)
+        while !accountsContainer.isAtEnd {
+            let account = try accountsContainer.nestedContainer(keyedBy: MerchantAccountKeys.self)
+            try merchantAccounts.append(
+                PaymentMethod.Agreement.MerchantAccount(
+                    id: account.decode(String.self, forKey: .id),
+                    paymentMethodOptionId: account.decode(String.self, forKey: .paymentMethodOptionId)
+                )
+            )
+        }
+
+        self.model = PaymentMethod.Agreement(
+            timeFrame: PaymentMethod.Agreement.TimeFrame(
+                // `time_frame` dates look like `2025-03-07T00:00:00.000-0400`.
+                startDate: FixedDateParser.date(iso8601: startDate) ?? Date(),
+                endDate: FixedDateParser.date(iso8601: endDate) ?? Date()
+            ),
+            merchantAccounts: merchantAccounts
+        )
+    }
+}
@@ -5,8 +5,11 @@
 //  Created by Guilherme Prata Costa on 18/02/25.
 //
 import Foundation
+#if SWIFT_PACKAGE
+    import MPCore
+#endif
 
-struct CardTokenBody: Codable {
+package struct CardTokenBody: Codable {
     let cardNumber: String?
     let expirationMonth: String?
     let expirationYear: String?
@@ -18,45 +21,76 @@ struct CardTokenBody: Codable {
     var buyerIdentification: BuyerIdentification?
 
     var device: Data?
+
+    package init(
+        cardNumber: String?,
+        expirationMonth: String?,
+        expirationYear: String?,
+        securityCode: String,
+        cardId: String? = nil,
+        esc: String? = nil,
+        requireEsc: Bool? = nil,
+        buyerIdentification: BuyerIdentification? = nil,
+        device: Data? = nil
+    ) {
+        self.cardNumber = cardNumber
+        self.expirationMonth = expirationMonth
+        self.expirationYear = expirationYear
+        self.securityCode = securityCode
+        self.cardId = cardId
+        self.esc = esc
+        self.requireEsc = requireEsc
+        self.buyerIdentification = buyerIdentification
+        self.device = device
+    }
 }
 
 extension CardTokenBody {
     /// Converts the `CardTokenBody` data to JSON format for use in a request body.
     ///
-    /// - Returns: A `Data` object representing the post data in JSON format, or `nil` if the conversion fails.
-    func toJSONData() -> Data? {
-        var jsonObject: [String: Any] = [
-            "card_number": cardNumber as Any,
-            "expiration_month": Double(expirationMonth ?? "") as Any,
-            "expiration_year": Double(expirationYear ?? "") as Any,
-            "security_code": securityCode,
-            "card_id": cardId as Any,
-            "esc": esc as Any,
-            "require_esc": requireEsc as Any
-        ]
+    /// The body is written straight into a buffer sized for the device fingerprint, whose
+    /// already encoded JSON is spliced in as is instead of being parsed and encoded again.
+    ///
+    /// - Returns: A `Data` object representing the post data in JSON format.
+    package func toJSONData() -> Data? {
+        var writer = JSONWriter(capacity: 256 + (self.device?.count ?? 0))
+
+        writer.beginObject()
+        writer.field("card_number", self.cardNumber)
+        writer.field("expiration_month", self.expirationMonth.flatMap(Double.init))
+        writer.field("expiration_year", self.expirationYear.flatMap(Double.init))
+        writer.field("security_code", self.securityCode)
+        writer.field("card_id", self.cardId)
+        writer.field("esc", self.esc)
+        writer.field("require_esc", self.requireEsc)
 
         if let buyerIdentification {
-            let holderDic: [String: Any] = [
-                "number": buyerIdentification.number ?? "",
-                "type": buyerIdentification.type ?? ""
-            ]
-            jsonObject["cardholder"] = [
-                "identification": holderDic,
-                "name": buyerIdentification.name
-            ]
+            writer.key("cardholder")
+            writer.beginObject()
+            writer.key("identification")
+            writer.beginObject()
+            writer.field("number", buyerIdentification.number ?? "")
+            writer.field("type", buyerIdentification.type ?? "")
+            writer.endObject()
+            writer.field("name", buyerIdentification.name)
+            writer.endObject()
         }
 
-        if let deviceData = device,
-           let deviceObject = try? JSONSerialization.jsonObject(with: deviceData, options: []) as? [String: Any] {
-            jsonObject["device"] = deviceObject            
-        }
+        writer.rawField("device", self.device)
+        writer.endObject()
 
-        return try? JSONSerialization.data(withJSONObject: jsonObject, options: [])
+        return writer.data
     }
 }
 
-struct BuyerIdentification: Codable {
+package struct BuyerIdentification: Codable {
     let name: String
     let number: String?
     let type: String?
+
+    package init(name: String, number: String?, type: String?) {
+        self.name = name
+        self.number = number
+        self.type = type
+    }
 }
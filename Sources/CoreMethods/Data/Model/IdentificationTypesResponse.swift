@@ -18,3 +18,15 @@ struct IdentificationTypesResponse: Codable, Sendable {
         case maxLength = "max_length"
     }
 }
+
+extension IdentificationType {
+    init(with data: IdentificationTypesResponse) {
+        self.init(
+            id: data.id,
+            name: data.name,
+            type: data.type,
+            minLenght: data.minLength,
+            maxLenght: data.maxLength
+        )
+    }
+}
@@ -10,23 +10,27 @@ import Foundation
     import MPCore
 #endif
 package final class CoreMethodsRepository: CoreMethodsRepositoryProtocol {
-    typealias Dependency = HasNetwork
+    typealias Dependency = HasNetwork & HasSiteIDProvider
     private typealias Endpoint = CoreMethodsEndpoint
 
     let dependencies: Dependency
 
-    private let installmentMapper: InstallmentsMapperProtocol
+    private let binCache: BinMetadataCache
 
-    private let paymentMethodMapper: PaymentMethodMapperProtocol
+    private let catalogCache: CatalogMemoryCache
+
+    private let revalidator: CatalogRevalidator
 
     init(
         dependencies: Dependency = CoreDependencyContainer.shared,
-        installmentMapper: InstallmentsMapperProtocol = InstallmentsMapper(),
-        paymentMethodMapper: PaymentMethodMapperProtocol = PaymentMethodMapper()
+        binCache: BinMetadataCache = .shared,
+        catalogCache: CatalogMemoryCache = .shared,
+        revalidator: CatalogRevalidator = .shared
     ) {
         self.dependencies = dependencies
-        self.installmentMapper = installmentMapper
-        self.paymentMethodMapper = paymentMethodMapper
+        self.binCache = binCache
+        self.catalogCache = catalogCache
+        self.revalidator = revalidator
     }
 
     func generateCardToken(_ data: CardTokenBody) async throws -> CardTokenResponse {
@@ -35,35 +39,239 @@ package final class CoreMethodsRepository: CoreMethodsRepositoryProtocol {
         )
     }
 
-    func getIdentificationTypes() async throws -> [IdentificationTypesResponse] {
-        return try await self.dependencies.networkService.request(
-            Endpoint.getIdentificationTypes
-        )
+    func getIdentificationTypes() async throws -> CatalogResult<[IdentificationTypesResponse]> {
+        let siteID = self.dependencies.siteIDProvider.siteID
+
+        if let cached = self.catalogCache.identificationTypes.result(for: siteID) {
+            if cached.isStale {
+                self.revalidator.revalidate(Endpoint.getIdentificationTypes.path + siteID) {
+                    guard let response = try? await self.fetchIdentificationTypes(siteID: siteID) else {
+                        return nil
+                    }
+
+                    let fetched = response.map(IdentificationType.init(with:))
+                    guard fetched != cached.value.map(IdentificationType.init(with:)) else { return nil }
+                    return .identificationTypes(fetched)
+                }
+            }
+            return cached
+        }
+
+        return CatalogResult(value: try await self.fetchIdentificationTypes(siteID: siteID))
     }
 
     func getInstallments(params: InstallmentsParams) async throws -> [Installment] {
-        let response: [InstallmentsResponse] = try await self.dependencies.networkService.request(
+        let siteID = self.dependencies.siteIDProvider.siteID
+        let keys = Self.binPrefixes(of: params.bin).map { bin in
+            CatalogMemoryCache.InstallmentsKey(
+                amount: params.amount,
+                bin: bin,
+                processingMode: params.processingMode,
+                siteID: siteID
+            )
+        }
+
+        // A prefetched 6-digit answer is reused only when it resolved a single plan: the full BIN
+        // may belong to a different issuer than its prefix.
+        let prefixMatches = keys.dropFirst().lazy.compactMap { self.catalogCache.installments.value(for: $0) }
+        if let cached = self.catalogCache.installments.value(for: keys[0])
+            ?? prefixMatches.first(where: { $0.count == 1 }) {
+            return cached
+        }
+
+        let response: DecodedModelList<DecodedInstallment> = try await self.dependencies.networkService.request(
             Endpoint.getInstallments(params: params)
         )
 
-        return self.installmentMapper.map(responses: response)
+        let installments = response.models
+        if let key = keys.first {
+            self.catalogCache.installments.insert(installments, for: key)
+        }
+        return installments
+    }
+
+    func getPaymentMethods(params: PaymentMethodsParams) async throws -> CatalogResult<[PaymentMethod]> {
+        let siteID = self.dependencies.siteIDProvider.siteID
+        let keys = Self.binPrefixes(of: params.bin).map { bin in
+            BinMetadataCache.Key(
+                resource: .paymentMethods,
+                bin: bin,
+                processingMode: params.processingMode,
+                siteID: siteID
+            )
+        }
+
+        // A prefetched 6-digit answer is reused only when it resolved a single brand.
+        return try await self.cachedRequest(
+            Endpoint.getPaymentMethods(params: params),
+            keys: keys,
+            maximumStaleness: self.revalidator.policy.paymentMethods,
+            decode: self.decodePaymentMethods,
+            update: { .paymentMethods(bin: keys[0].binPrefix, $0) },
+            acceptsPrefixMatch: { $0.count == 1 }
+        )
     }
 
-    func getPaymentMethods(params: PaymentMethodsParams) async throws -> [PaymentMethod] {
-        let response: [PaymentMethodResponse] = try await self.dependencies.networkService.request(
-            Endpoint.getPaymentMethods(params: params)
+    func getIssuers(params: IssuersParams) async throws -> CatalogResult<[Issuer]> {
+        let siteID = self.dependencies.siteIDProvider.siteID
+        let keys = Self.binPrefixes(of: params.bin).map { bin in
+            BinMetadataCache.Key(
+                resource: .issuers(paymentMethodID: params.paymentMethodID),
+                bin: bin,
+                processingMode: "",
+                siteID: siteID
+            )
+        }
+
+        // A prefetched 6-digit answer is reused only when it resolved a single issuer.
+        return try await self.cachedRequest(
+            Endpoint.getIssuers(params: params),
+            keys: keys,
+            maximumStaleness: self.revalidator.policy.issuers,
+            decode: self.decodeIssuers,
+            update: { .issuers(bin: keys[0].binPrefix, paymentMethodID: params.paymentMethodID, $0) },
+            acceptsPrefixMatch: { $0.count == 1 }
         )
+    }
+}
+
+// MARK: - Cache Keys
+
+extension CoreMethodsRepository {
+    /// Number of BIN digits known when `CoreMethods.prefetch(bin:amount:mode:)` runs.
+    static let prefetchBinLength = 6
+
+    /// BIN prefixes to look up, most specific first: the full key prefix, then the
+    /// 6-digit prefix a prefetch may have stored before the remaining digits were typed.
+    static func binPrefixes(of bin: String) -> [String] {
+        let full = String(bin.prefix(BinMetadataCache.Key.binPrefixLength))
+        let prefetched = String(bin.prefix(Self.prefetchBinLength))
 
-        return self.paymentMethodMapper.map(responses: response)
+        guard full.count > prefetched.count else {
+            return [full]
+        }
+        return [full, prefetched]
     }
+}
+
+// MARK: - BIN Cache
 
-    func getIssuers(params: IssuersParams) async throws -> [Issuer] {
-        let response: [IssuersResponse] = try await self.dependencies.networkService.request(
-            Endpoint.getIssuers(params: params)
+private extension CoreMethodsRepository {
+    /// Serves the first of `keys` from the BIN cache, stale-while-revalidate.
+    ///
+    /// - A fresh entry is returned as is.
+    /// - The remaining `keys` are shorter BIN prefixes; their fresh entries are used only when
+    ///   `acceptsPrefixMatch` approves the value.
+    /// - An entry stale by less than `maximumStaleness` is returned right away while it is
+    ///   revalidated in the background; a changed value is published as `update(value)`.
+    /// - Otherwise the value is fetched before returning. When the request fails fast because
+    ///   the endpoint's circuit is open or it is rate limited, an entry of any age is served stale.
+    ///
+    /// Fetched values are stored under the first key.
+    func cachedRequest<Value: Sendable>(
+        _ endpoint: Endpoint,
+        keys: [BinMetadataCache.Key],
+        maximumStaleness: TimeInterval,
+        decode: @escaping @Sendable (Data) throws -> Value,
+        update: @escaping @Sendable (Value) -> CatalogUpdate,
+        acceptsPrefixMatch: (Value) -> Bool = { _ in true }
+    ) async throws -> CatalogResult<Value> {
+        let key = keys[0]
+        let ttl = self.binCache.timeToLive
+        let cached = self.binCache.entry(for: key, decode: decode)
+
+        if let cached, cached.isFresh(ttl: ttl) {
+            return cached.result(ttl: ttl)
+        }
+
+        for prefixKey in keys.dropFirst() {
+            if let entry = self.binCache.entry(for: prefixKey, decode: decode),
+               entry.isFresh(ttl: ttl),
+               acceptsPrefixMatch(entry.value) {
+                return entry.result(ttl: ttl)
+            }
+        }
+
+        if let cached, cached.isUsable(ttl: ttl, maximumStaleness: maximumStaleness) {
+            self.revalidator.revalidate(key) {
+                guard let fetched = try? await self.fetch(endpoint, key: key, cached: cached, decode: decode),
+                      fetched.isNew else {
+                    return nil
+                }
+                return update(fetched.entry.value)
+            }
+            return cached.result(ttl: ttl)
+        }
+
+        do {
+            let (entry, _) = try await self.fetch(endpoint, key: key, cached: cached, decode: decode)
+            return entry.result(ttl: ttl)
+        } catch let error as APIClientError where error.isShortCircuited {
+            guard let cached else { throw error }
+            return cached.result(ttl: ttl)
+        }
+    }
+
+    /// Fetches `endpoint` into the BIN cache under `key`, revalidating with `If-None-Match`
+    /// when `cached` carries an `ETag`.
+    ///
+    /// - Returns: The stored entry and whether the server sent a new body (`false` on `304`).
+    func fetch<Value: Sendable>(
+        _ endpoint: Endpoint,
+        key: BinMetadataCache.Key,
+        cached: BinMetadataCache.Entry<Value>?,
+        decode: (Data) throws -> Value
+    ) async throws -> (entry: BinMetadataCache.Entry<Value>, isNew: Bool) {
+        var headers: [String: String] = [:]
+        if let etag = cached?.etag {
+            headers["If-None-Match"] = etag
+        }
+
+        let response = try await self.dependencies.networkService.requestData(
+            endpoint,
+            additionalHeaders: headers
         )
 
-        return response.map { data in
-            Issuer(with: data)
+        if response.isNotModified, let cached {
+            return (self.binCache.revalidate(cached, for: key), false)
+        }
+
+        let value: Value
+        let decodeStart = ProcessInfo.processInfo.systemUptime
+        do {
+            value = try decode(response.data)
+        } catch {
+            throw APIClientError.decodingFailed(error)
+        }
+        self.dependencies.networkService.metrics?.recordDecode(
+            ProcessInfo.processInfo.systemUptime - decodeStart,
+            endpoint: endpoint.path
+        )
+
+        return (self.binCache.insert(value, body: response.data, etag: response.etag, for: key), true)
+    }
+
+    func fetchIdentificationTypes(siteID: String) async throws -> [IdentificationTypesResponse] {
+        let response: [IdentificationTypesResponse] = try await self.dependencies.networkService.request(
+            Endpoint.getIdentificationTypes
+        )
+
+        self.catalogCache.identificationTypes.insert(response, for: siteID)
+        return response
+    }
+
+    func decodePaymentMethods(_ data: Data) throws -> [PaymentMethod] {
+        return try MPMetrics.shared.measure("core_methods.mapping.payment_methods") {
+            try JSONDecoder().decode(DecodedModelList<DecodedPaymentMethod>.self, from: data).models
+        }
+    }
+
+    func decodeIssuers(_ data: Data) throws -> [Issuer] {
+        return try MPMetrics.shared.measure("core_methods.mapping.issuers") {
+            let response = try JSONDecoder().decode([IssuersResponse].self, from: data)
+            return response.map { data in
+                Issuer(with: data)
+            }
         }
     }
 }
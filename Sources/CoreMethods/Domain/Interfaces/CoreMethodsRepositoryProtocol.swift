@@ -8,8 +8,8 @@ import Foundation
 
 protocol CoreMethodsRepositoryProtocol: Sendable {
     func generateCardToken(_ data: CardTokenBody) async throws -> CardTokenResponse
-    func getIdentificationTypes() async throws -> [IdentificationTypesResponse]
+    func getIdentificationTypes() async throws -> CatalogResult<[IdentificationTypesResponse]>
     func getInstallments(params: InstallmentsParams) async throws -> [Installment]
-    func getPaymentMethods(params: PaymentMethodsParams) async throws -> [PaymentMethod]
-    func getIssuers(params: IssuersParams) async throws -> [Issuer]
+    func getPaymentMethods(params: PaymentMethodsParams) async throws -> CatalogResult<[PaymentMethod]>
+    func getIssuers(params: IssuersParams) async throws -> CatalogResult<[Issuer]>
 }
@@ -57,7 +57,11 @@ final class GenerateCardTokenUseCase: GenerateCardTokenUseCaseProtocol {
             )
         }
 
-        let deviceData = await dependencies.fingerPrint.getDeviceData()
+        let deviceData = await MPTracer.shared.span("core_methods.tokenization.fingerprint") {
+            await MPMetrics.shared.measure("core_methods.tokenization.fingerprint") {
+                await dependencies.fingerPrint.getDeviceData()
+            }
+        }
 
         let cardData = CardTokenBody(
             cardNumber: cardNumber,
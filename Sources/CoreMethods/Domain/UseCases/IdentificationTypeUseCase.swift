@@ -6,7 +6,7 @@
 //
 
 protocol IdentificationTypesUseCaseProtocol: Sendable {
-    func getIdentificationTypes() async throws -> [IdentificationType]
+    func getIdentificationTypes() async throws -> CatalogResult<[IdentificationType]>
 }
 
 final class IdentificationTypesUseCase: IdentificationTypesUseCaseProtocol {
@@ -16,17 +16,11 @@ final class IdentificationTypesUseCase: IdentificationTypesUseCaseProtocol {
         self.repository = repository
     }
 
-    func getIdentificationTypes() async throws -> [IdentificationType] {
+    func getIdentificationTypes() async throws -> CatalogResult<[IdentificationType]> {
         let response = try await repository.getIdentificationTypes()
 
-        return response.map { data in
-            IdentificationType(
-                id: data.id,
-                name: data.name,
-                type: data.type,
-                minLenght: data.minLength,
-                maxLenght: data.maxLength
-            )
+        return response.map { types in
+            types.map(IdentificationType.init(with:))
         }
     }
 }
@@ -6,7 +6,7 @@
 //
 
 protocol IssuerUseCaseProtocol: Sendable {
-    func getIssuers(params: IssuersParams) async throws -> [Issuer]
+    func getIssuers(params: IssuersParams) async throws -> CatalogResult<[Issuer]>
 }
 
 final class IssuerUseCase: IssuerUseCaseProtocol {
@@ -16,7 +16,7 @@ final class IssuerUseCase: IssuerUseCaseProtocol {
         self.repository = repository
     }
 
-    func getIssuers(params: IssuersParams) async throws -> [Issuer] {
+    func getIssuers(params: IssuersParams) async throws -> CatalogResult<[Issuer]> {
         return try await self.repository.getIssuers(params: params)
     }
 }
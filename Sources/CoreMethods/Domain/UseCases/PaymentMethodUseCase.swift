@@ -6,7 +6,7 @@
 //
 
 protocol PaymentMethodUseCaseProtocol: Sendable {
-    func getPaymentMethods(params: PaymentMethodsParams) async throws -> [PaymentMethod]
+    func getPaymentMethods(params: PaymentMethodsParams) async throws -> CatalogResult<[PaymentMethod]>
 }
 
 final class PaymentMethodUseCase: PaymentMethodUseCaseProtocol {
@@ -16,7 +16,7 @@ final class PaymentMethodUseCase: PaymentMethodUseCaseProtocol {
         self.repository = repository
     }
 
-    func getPaymentMethods(params: PaymentMethodsParams) async throws -> [PaymentMethod] {
+    func getPaymentMethods(params: PaymentMethodsParams) async throws -> CatalogResult<[PaymentMethod]> {
         return try await self.repository.getPaymentMethods(params: params)
     }
 }
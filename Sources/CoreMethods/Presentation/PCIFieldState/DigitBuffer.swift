@@ -0,0 +1,161 @@
+//
+//  DigitBuffer.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Digits typed in a `PCIFieldState`, edited in place on every keystroke.
+///
+/// The buffer holds ASCII digit bytes only. Storage is reserved once for `capacity` bytes,
+/// so typing never reallocates, and the Luhn checksum is kept up to date incrementally:
+/// appending or deleting the last digit is O(1), edits in the middle rescan the buffer.
+struct DigitBuffer: Equatable {
+    /// Reserved size of the storage. Covers the longest card number (19 digits).
+    static let capacity = 32
+
+    private(set) var bytes: [UInt8]
+
+    /// Count and Luhn checksum of the digits.
+    private(set) var scan = DigitKernel.Scan()
+
+    /// Luhn checksum the digits would have if one more digit were appended.
+    /// Appending a digit moves every existing digit to the opposite doubling position.
+    private var shiftedLuhnSum = 0
+
+    init() {
+        self.bytes = []
+        self.bytes.reserveCapacity(Self.capacity)
+    }
+
+    /// Creates a buffer with the digits of `text`, skipping any other character.
+    init(text: String) {
+        self.init()
+        self.replace(0 ..< 0, with: text.utf8)
+    }
+
+    var count: Int {
+        self.bytes.count
+    }
+
+    var isEmpty: Bool {
+        self.bytes.isEmpty
+    }
+
+    /// The digits as a string.
+    var digits: String {
+        String(decoding: self.bytes, as: UTF8.self)
+    }
+
+    /// Replaces the digits in `range` with the digits of `replacement`, skipping any other byte.
+    mutating func replace<Bytes: Collection>(_ range: Range<Int>, with replacement: Bytes)
+        where Bytes.Element == UInt8 {
+        let isTail = range.upperBound == self.bytes.count
+
+        if isTail {
+            for _ in range {
+                self.removeLast()
+            }
+            for byte in replacement where DigitKernel.isDigit(byte) {
+                self.append(byte)
+            }
+            return
+        }
+
+        self.bytes.replaceSubrange(range, with: replacement.lazy.filter(DigitKernel.isDigit))
+        self.rescan()
+    }
+
+    mutating func removeAll() {
+        self.bytes.removeAll(keepingCapacity: true)
+        self.scan = DigitKernel.Scan()
+        self.shiftedLuhnSum = 0
+    }
+
+    /// Formats the digits with `mask`, where `#` takes the next digit and any other character
+    /// is rendered as `mask.separator`. Digits past the end of the pattern are not rendered.
+    func render(_ mask: PCIFieldState.Configuration.Mask?) -> String {
+        guard let mask else {
+            return self.digits
+        }
+
+        var result = ""
+        result.reserveCapacity(mask.pattern.utf8.count)
+        var index = 0
+
+        for char in mask.pattern {
+            guard index < self.bytes.count else { break }
+
+            if char == "#" {
+                result.unicodeScalars.append(Unicode.Scalar(self.bytes[index]))
+                index += 1
+            } else {
+                result.append(mask.separator)
+            }
+        }
+
+        return result
+    }
+
+    /// Maps a UTF-16 range of `rendered` (the text produced by `render(_:)`) to the range of
+    /// the digits it covers.
+    ///
+    /// - Returns: `nil` when `range` lies outside `rendered`.
+    static func digitRange(of range: NSRange, in rendered: String) -> Range<Int>? {
+        guard range.location != NSNotFound,
+              range.location >= 0, range.length >= 0,
+              range.location + range.length <= rendered.utf16.count else {
+            return nil
+        }
+
+        var lower = 0
+        var upper = 0
+        for (offset, unit) in rendered.utf16.prefix(range.location + range.length).enumerated()
+            where unit < 0x80 && DigitKernel.isDigit(UInt8(unit)) {
+            if offset < range.location {
+                lower += 1
+            }
+            upper += 1
+        }
+
+        return lower ..< upper
+    }
+}
+
+// MARK: - Private Methods
+
+private extension DigitBuffer {
+    mutating func append(_ byte: UInt8) {
+        self.bytes.append(byte)
+        self.accumulate(DigitKernel.value(of: byte))
+    }
+
+    /// Adds a digit appended at the end to the checksums.
+    mutating func accumulate(_ digit: Int) {
+        let luhnSum = self.scan.luhnSum
+
+        self.scan.count += 1
+        self.scan.luhnSum = self.shiftedLuhnSum + digit
+        self.shiftedLuhnSum = luhnSum + DigitKernel.doubled(digit)
+    }
+
+    mutating func removeLast() {
+        let digit = DigitKernel.value(of: self.bytes.removeLast())
+        let shiftedLuhnSum = self.shiftedLuhnSum
+
+        self.scan.count -= 1
+        self.shiftedLuhnSum = self.scan.luhnSum - digit
+        self.scan.luhnSum = shiftedLuhnSum - DigitKernel.doubled(digit)
+    }
+
+    mutating func rescan() {
+        self.scan = DigitKernel.Scan()
+        self.shiftedLuhnSum = 0
+
+        for byte in self.bytes {
+            self.accumulate(DigitKernel.value(of: byte))
+        }
+    }
+}
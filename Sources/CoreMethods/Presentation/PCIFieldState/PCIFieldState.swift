@@ -38,6 +38,18 @@ final class PCIFieldState: UIView {
     private var formatter: Configuration.Mask?
     private var style: Style
 
+    /// Digits of the field, edited in place on each keystroke.
+    private var buffer = DigitBuffer()
+
+    /// Text last written to `textField` from `buffer`.
+    private var renderedText = ""
+
+    /// Most digits the field accepts. Digits past the end of the mask would not be shown, so
+    /// they are rejected rather than validated and tokenized unseen.
+    private var digitLimit: Int {
+        min(self.maxLength, self.formatter?.capacity ?? self.maxLength)
+    }
+
     // MARK: - Callbacks
 
     var onChange: ((String) -> Void)?
@@ -51,6 +63,11 @@ final class PCIFieldState: UIView {
         struct Mask {
             let pattern: String // Ex: "#### #### #### ####"
             let separator: Character // Ex: " "
+
+            /// Digits the pattern can show, one per `#`.
+            var capacity: Int {
+                self.pattern.utf8.reduce(0) { $1 == UInt8(ascii: "#") ? $0 + 1 : $0 }
+            }
         }
 
         let maxLength: Int
@@ -108,14 +125,17 @@ final class PCIFieldState: UIView {
     /// SECURITY: This method should never be exposed to SDK integrators
     /// @warning: Do not expose this method through public interfaces
     func getValue() -> String {
-        self.textField.text?.onlyNumbers() ?? ""
+        self.synchronizeBuffer()
+        return self.buffer.digits
     }
 
     // MARK: - Public Methods
 
     func clear() {
         self.textField.text = nil
-        updateState(text: "")
+        self.buffer.removeAll()
+        self.renderedText = ""
+        updateState()
     }
 
     func setPlaceholder(_ text: String) {
@@ -181,12 +201,25 @@ private extension PCIFieldState {
         self.textField.layer.opacity = self.style.opacity
     }
 
-    func updateState(text: String) {
-        let numbersOnly = text.onlyNumbers()
-        self.count = numbersOnly.count
+    /// Rebuilds the buffer when the text was set outside the delegate (e.g. by autofill).
+    func synchronizeBuffer() {
+        let text = self.textField.text ?? ""
+        guard text != self.renderedText else { return }
+
+        self.buffer = DigitBuffer(text: text)
+        self.renderedText = text
+    }
 
-        self.isValid = self.validation.isValid(text)
-        self.onChange?(numbersOnly)
+    func updateState() {
+        self.count = self.buffer.count
+
+        self.isValid = MPMetrics.shared.measure("core_methods.field_validation") {
+            if let validation = self.validation as? DigitScanValidation {
+                return validation.isValid(self.buffer.scan)
+            }
+            return self.validation.isValid(self.renderedText)
+        }
+        self.onChange?(self.buffer.digits)
 
         if self.isValid {
             self.onComplete?()
@@ -235,20 +268,22 @@ extension PCIFieldState: UITextFieldDelegate {
         shouldChangeCharactersIn range: NSRange,
         replacementString string: String
     ) -> Bool {
-        let currentText = textField.text ?? ""
-        guard let stringRange = Range(range, in: currentText) else { return false }
-        let updatedText = currentText.replacingCharacters(in: stringRange, with: string)
-        let numbersOnly = updatedText.onlyNumbers()
+        self.synchronizeBuffer()
+        guard let digitRange = DigitBuffer.digitRange(of: range, in: self.renderedText) else { return false }
 
-        guard numbersOnly.count <= self.maxLength else { return false }
+        var updated = self.buffer
+        updated.replace(digitRange, with: string.utf8)
 
-        if let formatter {
-            textField.text = numbersOnly.applyMask(formatter.pattern, separator: formatter.separator)
-        } else {
-            textField.text = numbersOnly
-        }
+        guard updated.count <= self.digitLimit else { return false }
+
+        self.renderedText = updated.render(self.formatter)
+        textField.text = self.renderedText
+
+        // Deleting a separator or typing a non-digit leaves the digits untouched.
+        guard updated != self.buffer else { return false }
 
-        self.updateState(text: updatedText)
+        self.buffer = updated
+        self.updateState()
 
         return false
     }
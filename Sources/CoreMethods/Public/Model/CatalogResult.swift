@@ -0,0 +1,37 @@
+//
+//  CatalogResult.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+import Foundation
+
+/// A catalog value together with how old it is.
+///
+/// Identification types, payment methods and issuers are served stale-while-revalidate: once their
+/// cache lifetime ends, the last known value is still returned right away (with `isStale == true`)
+/// while a fresher one is fetched in the background and published through
+/// ``CoreMethods/catalogUpdates()``.
+public struct CatalogResult<Value: Sendable>: Sendable {
+    /// The catalog data.
+    public let value: Value
+
+    /// Time, in seconds, since the value was fetched. `0` when it was fetched by this call.
+    public let age: TimeInterval
+
+    /// Whether the value is past its cache lifetime and is being refreshed.
+    public let isStale: Bool
+
+    public init(value: Value, age: TimeInterval = 0, isStale: Bool = false) {
+        self.value = value
+        self.age = age
+        self.isStale = isStale
+    }
+
+    /// Returns a result holding `transform(value)` with the same age.
+    public func map<T: Sendable>(_ transform: (Value) throws -> T) rethrows -> CatalogResult<T> {
+        CatalogResult<T>(value: try transform(self.value), age: self.age, isStale: self.isStale)
+    }
+}
+
+extension CatalogResult: Equatable where Value: Equatable {}
@@ -0,0 +1,16 @@
+//
+//  CatalogUpdate.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+import Foundation
+
+/// Fresher catalog data fetched in the background after a stale value was served.
+///
+/// BINs are the cache key prefix of the request (up to 8 digits).
+public enum CatalogUpdate: Sendable {
+    case identificationTypes([IdentificationType])
+    case paymentMethods(bin: String, [PaymentMethod])
+    case issuers(bin: String, paymentMethodID: String, [Issuer])
+}
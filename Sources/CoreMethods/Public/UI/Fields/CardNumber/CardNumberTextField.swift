@@ -77,6 +77,9 @@ public final class CardNumberTextField: PCITextField {
     
     private var previousBin: String = ""
 
+    /// Whether a digit was typed, so the first keystroke is traced once.
+    private var didReceiveInput = false
+
     typealias Dependency = HasAnalytics
 
     /// Internal property for dependency injection in tests
@@ -120,6 +123,7 @@ public final class CardNumberTextField: PCITextField {
         buildLayout()
         self.setupCallbacks()
         self.sendAnalyticsEvent()
+        MPTracer.shared.event("card_field.created")
     }
 
     /// Internal initializer for testing purposes
@@ -169,6 +173,11 @@ public final class CardNumberTextField: PCITextField {
             
             let inputLength = text.count
             self.onLengthChanged?(inputLength)
+
+            if inputLength > 0, !self.didReceiveInput {
+                self.didReceiveInput = true
+                MPTracer.shared.event("card_field.first_keystroke")
+            }
             
             let currentBin = getBin(text)
 
@@ -176,6 +185,9 @@ public final class CardNumberTextField: PCITextField {
 
             if inputLength >= self.binLength && currentBin != previousBinPrefix || inputLength == 0  {
                 self.previousBin = currentBin
+                if inputLength > 0 {
+                    MPTracer.shared.event("card_field.bin_complete", attributes: ["bin_length": "\(currentBin.count)"])
+                }
                 self.onBinChanged?(currentBin)
             }
 
@@ -242,6 +254,18 @@ extension CardNumberTextField {
         return self
     }
 
+    /// Applies the length bounds and check digit rule of a card brand.
+    ///
+    /// Use the `card` of the payment method returned by `CoreMethods.paymentMethods(bin:mode:)`.
+    /// - Parameter cardInfo: Card brand information
+    /// - Returns: Self for method chaining
+    @discardableResult
+    public func setCardInfo(_ cardInfo: PaymentMethod.CardInfo) -> Self {
+        self.input.setMaxLenght(cardInfo.length.max)
+        self.validation.apply(cardInfo)
+        return self
+    }
+
     /// Updates the mask pattern used for formatting the card number.
     /// - Parameters:
     ///   - pattern: The new mask pattern where '#' represents a digit
@@ -11,29 +11,48 @@ public enum CardNumberError {
     case none
 }
 
-class CardNumberValidation: InputValidation {
+package class CardNumberValidation: DigitScanValidation {
     var error: CardNumberError
 
     var maxLength: Int
 
+    /// Minimum number of digits accepted.
+    var minLength: Int
+
+    /// Whether the Luhn check digit is verified. Some brands are issued without one.
+    var requiresLuhn: Bool
+
     enum Constant {
         static let minLength = 8
+        static let noValidation = "none"
     }
 
-    init(error: CardNumberError = .empty, maxLength: Int) {
+    package init(error: CardNumberError = .empty, maxLength: Int) {
         self.error = error
         self.maxLength = maxLength
+        self.minLength = Constant.minLength
+        self.requiresLuhn = true
+    }
+
+    /// Applies the brand rules returned by `paymentMethods(bin:mode:)`.
+    /// - Parameter cardInfo: Length bounds and validation kind of the card brand.
+    func apply(_ cardInfo: PaymentMethod.CardInfo) {
+        self.minLength = cardInfo.length.min
+        self.maxLength = cardInfo.length.max
+        self.requiresLuhn = cardInfo.validation != Constant.noValidation
     }
 
-    func isValid(_ text: String) -> Bool {
-        let cleanNumber = text.replacingOccurrences(of: "[^0-9]", with: "", options: .regularExpression)
+    package func isValid(_ text: String) -> Bool {
+        self.isValid(DigitKernel.scan(text))
+    }
 
-        guard cleanNumber.count >= Constant.minLength, cleanNumber.count <= self.maxLength else {
+    func isValid(_ scan: DigitKernel.Scan) -> Bool {
+        guard scan.count >= self.minLength, scan.count <= self.maxLength else {
             self.error = .invalidLength
             return false
         }
 
-        if self.isValidLuhn(cleanNumber) {
+        if !self.requiresLuhn || scan.passesLuhn {
             self.error = .none
             return true
         } else {
@@ -41,34 +60,4 @@ class CardNumberValidation: InputValidation {
             return false
         }
     }
-
-    private func isValidLuhn(_ number: String) -> Bool {
-        guard !number.isEmpty else {
-            self.error = .invalidLuhn
-            return false
-        }
-        var sum = 0
-
-        let digitStrings = number.reversed().map { String($0) }
-
-        for tuple in digitStrings.enumerated() {
-            if let digit = Int(tuple.element) {
-                let odd = tuple.offset % 2 == 1
-
-                switch (odd, digit) {
-                case (true, 9):
-                    sum += 9
-                case (true, 0 ... 8):
-                    sum += (digit * 2) % 9
-                default:
-                    sum += digit
-                }
-            } else {
-                self.error = .invalidLuhn
-                return false
-            }
-        }
-
-        return sum % 10 == 0
-    }
 }
@@ -205,33 +205,16 @@ public final class ExpirationDateTextfield: PCITextField {
 
     func getMonth() -> String {
         guard let expirationDate = getDate() else { return "" }
-        return String(Calendar.current.component(.month, from: expirationDate))
+        return String(expirationDate.month)
     }
 
     func getYear() -> String {
         guard let expirationDate = getDate() else { return "" }
-        return String(Calendar.current.component(.year, from: expirationDate))
+        return String(expirationDate.year)
     }
 
-    private func getDate() -> Date? {
-        var text = input.textField.text ?? ""
-
-        if !text.isEmpty {
-            let dateFormatter = DateFormatter()
-            if self.format == .short {
-                text.insert(
-                    contentsOf: Calendar.current.firstTwoDigitsOfYear(),
-                    at: text.index(text.startIndex, offsetBy: 3)
-                )
-                dateFormatter.dateFormat = "MM/yy"
-            } else {
-                dateFormatter.dateFormat = "MM/yyyy"
-            }
-
-            return dateFormatter.date(from: text)
-        } else {
-            return nil
-        }
+    private func getDate() -> YearMonth? {
+        ExpirationDateValidation.parse(input.textField.text ?? "", clock: self.validation.clock)
     }
 }
 
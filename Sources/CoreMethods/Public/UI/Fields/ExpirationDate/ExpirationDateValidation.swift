@@ -19,41 +19,24 @@ public enum ExpirationDateError {
     case none
 }
 
-class ExpirationDateValidation: InputValidation {
+package class ExpirationDateValidation: InputValidation {
     var error: ExpirationDateError
 
-    init(error: ExpirationDateError = .empty) {
+    /// Current month, against which expiration is checked.
+    let clock: any YearMonthClock
+
+    package init(error: ExpirationDateError = .empty, clock: any YearMonthClock = SystemYearMonthClock.shared) {
         self.error = error
+        self.clock = clock
     }
 
-    func isValid(_ text: String) -> Bool {
-        let components = text.split(separator: "/")
-        guard components.count == 2,
-              let month = Int(components[0]),
-              let yearStr = components.last,
-              let year = Int(yearStr) else {
-            self.error = .invalidDate
-            return false
-        }
-
-        let fullYear: Int
-        if yearStr.count == 2 {
-            fullYear = 2000 + year
-        } else {
-            fullYear = year
-        }
-
-        let currentDate = Date()
-        let calendar = Calendar.current
-        let currentYear = calendar.component(.year, from: currentDate)
-        let currentMonth = calendar.component(.month, from: currentDate)
-
-        if month < 1 || month > 12 {
+    package func isValid(_ text: String) -> Bool {
+        guard let date = Self.parse(text, clock: self.clock) else {
             self.error = .invalidDate
             return false
         }
 
-        if fullYear < currentYear || (fullYear == currentYear && month < currentMonth) {
+        if date < self.clock.current {
             self.error = .expired
             return false
         }
@@ -61,4 +44,11 @@ class ExpirationDateValidation: InputValidation {
         self.error = .none
         return true
     }
+
+    /// Parses `MM/YY` or `MM/YYYY` over the UTF-8 bytes of `text`.
+    /// - Returns: Month and four-digit year, or `nil` when the format does not match or the
+    ///   month is not 1 to 12. Two-digit years belong to the century of `clock`.
+    static func parse(_ text: String, clock: any YearMonthClock = SystemYearMonthClock.shared) -> YearMonth? {
+        FixedDateParser.expiration(text, century: clock.current.century)
+    }
 }
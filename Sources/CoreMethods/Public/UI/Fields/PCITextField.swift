@@ -43,6 +43,11 @@ public class PCITextField: UIView {
 
     private let contentType: UITextContentType?
 
+    /// Network whose connection is kept warm while the field is on screen.
+    var network: HasNetwork = CoreDependencyContainer.shared
+
+    private var isRetainingConnections = false
+
     // MARK: - Initialization
 
     init(
@@ -62,6 +67,22 @@ public class PCITextField: UIView {
     required init?(coder _: NSCoder) {
         fatalError("init(coder:) has not been implemented")
     }
+
+    /// Keeps the API connection warm while the checkout form is visible, so tokenization
+    /// does not pay a new connection setup.
+    override public func didMoveToWindow() {
+        super.didMoveToWindow()
+
+        let isVisible = window != nil
+        guard isVisible != self.isRetainingConnections else { return }
+
+        self.isRetainingConnections = isVisible
+        if isVisible {
+            self.network.networkService.retainConnections()
+        } else {
+            self.network.networkService.releaseConnections()
+        }
+    }
 }
 
 // MARK: - ViewConfiguration Extensions
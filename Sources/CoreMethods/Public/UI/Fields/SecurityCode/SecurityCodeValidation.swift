@@ -9,7 +9,7 @@ public enum SecurityCodeError {
     case none
 }
 
-class SecurityCodeValidation: InputValidation {
+class SecurityCodeValidation: DigitScanValidation {
     var error: SecurityCodeError
 
     var maxLength: Int
@@ -20,9 +20,11 @@ class SecurityCodeValidation: InputValidation {
     }
 
     func isValid(_ text: String) -> Bool {
-        let cleanNumber = text.replacingOccurrences(of: "[^0-9]", with: "", options: .regularExpression)
+        self.isValid(DigitKernel.Scan(count: DigitKernel.digitCount(text)))
+    }
 
-        guard cleanNumber.count >= self.maxLength else {
+    func isValid(_ scan: DigitKernel.Scan) -> Bool {
+        guard scan.count >= self.maxLength else {
             self.error = .invalidLength
             return false
         }
@@ -0,0 +1,40 @@
+//
+//  NetworkPathObserver.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+import Network
+
+/// Notifies when the device network path changes (e.g. WiFi to cellular, offline).
+package protocol NetworkPathObserving: Sendable {
+    /// Starts observing. `onChange` is called on a background queue for every path update.
+    func start(onChange: @escaping @Sendable () -> Void)
+}
+
+/// `NWPathMonitor` backed implementation of `NetworkPathObserving`.
+package final class NetworkPathObserver: NetworkPathObserving, @unchecked Sendable {
+    private let monitor = NWPathMonitor()
+    private let queue = DispatchQueue(label: "com.mercadopago.analytics.path", qos: .utility)
+    private let lock = NSLock()
+    private var isStarted = false
+
+    package init() {}
+
+    deinit {
+        monitor.cancel()
+    }
+
+    package func start(onChange: @escaping @Sendable () -> Void) {
+        lock.lock()
+        defer { lock.unlock() }
+
+        guard !isStarted else { return }
+        isStarted = true
+
+        monitor.pathUpdateHandler = { _ in onChange() }
+        monitor.start(queue: queue)
+    }
+}
@@ -46,19 +46,14 @@ package extension AnalyticsEventData {
     }
 }
 
-private enum APIAnalytics {
-    static let url = "https://api.mercadolibre.com/tracks"
-}
-
 /// Defines the core analytics tracking functionality.
 ///
 /// This protocol provides methods for:
-/// - Tracking custom events
-/// - Tracking screen views
-/// - Configuring event data
+/// - Building event and screen view values
+/// - Submitting built events for processing
 /// - Accessing seller and buyer information
 ///
-/// All operations are asynchronous and thread-safe.
+/// Events are immutable `AnalyticsEvent` values, so concurrent callers never share mutable state.
 package protocol AnalyticsInterface: Sendable {
     /// Information related to the seller/merchant.
     var sellerInfo: MPSellerInfo { get }
@@ -72,218 +67,211 @@ package protocol AnalyticsInterface: Sendable {
     /// - Parameter siteID: Site ID of the app.
     func initialize(version: String, siteID: String) async
 
-    /// Sets custom data for the next event.
+    /// Submits a built event for processing.
     ///
-    /// - Parameter data: Object implementing `AnalyticsEventData` containing event data.
-    /// - Returns: Self instance for method chaining.
-    @discardableResult
-    func setEventData(_ data: AnalyticsEventData) async -> AnalyticsInterface
+    /// - Parameter event: Event to be sent.
+    func send(_ event: AnalyticsEvent) async
 
-    /// Sets error in event data for the next event.
+    /// Routes track uploads through `gate`, or sends them directly with `nil`.
+    func setUploadGate(_ gate: AnalyticsUploadGate?) async
+
+    /// Attaches `siteID` to the tracks sent from now on. Ignored before `initialize`.
     ///
-    /// - Parameter error: String of error
-    /// - Returns: Self instance for method chaining.
-    @discardableResult
-    func setError(_ error: String) async -> AnalyticsInterface
+    /// - Parameter siteID: Site ID resolved by the SDK.
+    func updateSiteID(_ siteID: String)
+}
 
-    /// Tracks a custom event.
+package extension AnalyticsInterface {
+    func setUploadGate(_: AnalyticsUploadGate?) async {}
+
+    func updateSiteID(_: String) {}
+
+    /// Starts building a custom event.
     ///
     /// - Parameter path: Path identifying the event (e.g., "payment/credit_card").
-    /// - Returns: Self instance for method chaining.
-    @discardableResult
-    func trackEvent(_ path: String) async -> AnalyticsInterface
+    /// - Returns: Event value submitted to this instance on `send()`.
+    func trackEvent(_ path: String) -> AnalyticsEvent {
+        AnalyticsEvent(path: path, type: .event, analytics: self)
+    }
 
-    /// Tracks a screen view.
+    /// Starts building a screen view.
     ///
     /// - Parameter path: Path identifying the screen (e.g., "checkout/review").
-    /// - Returns: Self instance for method chaining.
-    @discardableResult
-    func trackView(_ path: String) async -> AnalyticsInterface
-
-    /// Sends the current event for processing.
-    func send() async
+    /// - Returns: Event value submitted to this instance on `send()`.
+    func trackView(_ path: String) -> AnalyticsEvent {
+        AnalyticsEvent(path: path, type: .view, analytics: self)
+    }
 }
 
 /// Core analytics implementation for the MercadoPago SDK.
 ///
 /// This class is responsible for:
-/// - Collecting events and screen views
 /// - Aggregating environment data
-/// - Formatting and sending analytics data
+/// - Formatting events into tracks
+/// - Handing tracks to `AnalyticsQueue` for delivery
 ///
-/// Implemented as a Swift actor to ensure thread-safety in concurrent operations.
+/// A single long-lived instance (`MPAnalytics.shared`) is used by the SDK. It holds no
+/// per-event state, so it can be used concurrently. Environment data is read from an
+/// `AnalyticsContext` snapshot built on `initialize` and refreshed on network path changes
+/// and site ID updates.
 ///
 /// Example:
 /// ```swift
-/// let analytics = MPAnalytics()
-/// await analytics
+/// await MPAnalytics.shared
 ///     .trackEvent("payment/credit_card")
 ///     .setEventData(paymentData)
 ///     .send()
 /// ```
-package final class MPAnalytics: AnalyticsInterface {
-    actor TrackEvent {
-        /// Custom data for the current event.
-        private var eventData: AnalyticsEventData?
-
-        /// Path identifying the current event or view.
-        private var path = ""
-
-        /// Type of the current tracking (event or view).
-        private var type: TrackType = .event
-
-        private var error: String?
-
-        func setError(_ error: String?) {
-            self.error = error
-        }
-
-        func getError() -> String? {
-            return self.error
-        }
+package final class MPAnalytics: AnalyticsInterface, @unchecked Sendable {
+    /// Shared analytics engine.
+    package static let shared = MPAnalytics()
 
-        func setEventData(_ data: AnalyticsEventData?) {
-            self.eventData = data
-        }
-
-        func getEventData() -> AnalyticsEventData? {
-            return self.eventData
-        }
-
-        func setType(_ type: TrackType) {
-            self.type = type
-        }
+    /// Service providing seller information.
+    package let sellerInfo = MPSellerInfo()
 
-        func getType() -> TrackType {
-            return self.type
-        }
+    /// Service providing buyer and device information.
+    package let buyerInfo: MPBuyerInfo
 
-        func setPath(_ path: String) {
-            self.path = path
-        }
+    /// Batches tracks into multi-track uploads.
+    private let queue: AnalyticsQueue
 
-        func getPath() -> String {
-            return self.path
-        }
-    }
+    /// Triggers a connectivity refresh of the context snapshot.
+    private let pathObserver: NetworkPathObserving
 
-    let track = TrackEvent()
+    private let lock = NSLock()
 
-    /// Service providing seller information.
-    package let sellerInfo = MPSellerInfo()
-
-    /// Service providing buyer and device information.
-    package let buyerInfo = MPBuyerInfo()
+    /// Environment snapshot attached to every track. `nil` until `initialize` is called.
+    private var currentContext: AnalyticsContext?
 
     /// Initializes a new Analytics instance.
     ///
-    /// Creates a new UUID session identifier.
-    package init() {}
+    /// - Parameters:
+    ///   - queue: Queue delivering tracks in batches. Defaults to the shared queue.
+    ///   - buyerInfo: Service providing buyer and device information.
+    ///   - pathObserver: Observer notifying network path changes.
+    package init(
+        queue: AnalyticsQueue = .shared,
+        buyerInfo: MPBuyerInfo = MPBuyerInfo(),
+        pathObserver: NetworkPathObserving = NetworkPathObserver()
+    ) {
+        self.queue = queue
+        self.buyerInfo = buyerInfo
+        self.pathObserver = pathObserver
+    }
+
+    /// Current environment snapshot.
+    package var context: AnalyticsContext? {
+        lock.lock()
+        defer { lock.unlock() }
+        return currentContext
+    }
 
     // MARK: - Interface Implementation
 
+    /// Initializes the configuration and builds the environment snapshot.
+    ///
+    /// This is the only place that hops to the main actor and probes the network type;
+    /// afterwards the network type is refreshed only when the network path changes.
     package func initialize(version: String, siteID: String) async {
         await MPAnalyticsConfiguration.shared.initialize(version: version, siteID: siteID)
-    }
+        let sessionID = await MPAnalyticsConfiguration.shared.sessionID
 
-    @discardableResult
-    package func setEventData(_ data: AnalyticsEventData) async -> AnalyticsInterface {
-        await self.track.setEventData(data)
+        let (uid, osVersion) = await MainActor.run {
+            (self.buyerInfo.getUID(), self.buyerInfo.getiOSVersion())
+        }
 
-        return self
+        let context = AnalyticsContext(
+            uid: uid,
+            sessionID: sessionID,
+            siteID: siteID,
+            version: version,
+            appName: self.sellerInfo.getBundleIdentifier(),
+            osVersion: osVersion,
+            connectivityType: self.buyerInfo.getNetworkType()
+        )
+        self.setContext(context)
+
+        self.pathObserver.start { [weak self] in
+            self?.refreshConnectivity()
+        }
     }
 
-    @discardableResult
-    package func setError(_ error: String) async -> AnalyticsInterface {
-        await self.track.setError(error)
+    /// Re-reads the network type into the context snapshot.
+    func refreshConnectivity() {
+        guard let context = self.context else { return }
 
-        return self
-    }
-
-    @discardableResult
-    package func trackEvent(_ path: String) async -> AnalyticsInterface {
-        await self.track.setType(.event)
-        await self.track.setPath(path)
+        let connectivityType = self.buyerInfo.getNetworkType()
+        guard connectivityType != context.connectivityType else { return }
 
-        return self
+        lock.lock()
+        // Skip when `initialize` replaced the snapshot while the network type was probed.
+        if currentContext === context {
+            currentContext = context.updating(connectivityType: connectivityType)
+        }
+        lock.unlock()
     }
 
-    @discardableResult
-    package func trackView(_ path: String) async -> AnalyticsInterface {
-        await self.track.setType(.view)
-        await self.track.setPath(path)
+    package func updateSiteID(_ siteID: String) {
+        lock.lock()
+        defer { lock.unlock() }
 
-        return self
+        guard let context = currentContext, context.siteID != siteID else { return }
+        currentContext = context.updating(siteID: siteID)
     }
 
-    /// Processes and sends the current event.
+    /// Processes and enqueues an event.
     ///
     /// This method:
-    /// 1. Collects user information,
-    /// 2. Builds the payload with all required data,
-    /// 3. Serializes to JSON,
-    /// 4. Sends the data (currently just prints to console).
-    ///
-    /// - Note: Actual data sending implementation should be added in the future.
-    package func send() async {
-        guard await !MPAnalyticsConfiguration.shared.version.isEmpty,
-              await !MPAnalyticsConfiguration.shared.siteID.isEmpty else {
+    /// 1. Reads the environment snapshot,
+    /// 2. Builds the track with all required data,
+    /// 3. Serializes it to JSON,
+    /// 4. Hands it to `AnalyticsQueue`, which uploads tracks in batches.
+    package func send(_ event: AnalyticsEvent) async {
+        guard let context = self.context,
+              !context.version.isEmpty,
+              !context.siteID.isEmpty else {
+            return
+        }
+        guard let jsonData = Self.encodePayload(for: event, context: context) else {
             return
         }
-        let payload = await buildPayload()
-
-        do {
-            let jsonData = try JSONSerialization.data(withJSONObject: payload, options: [])
-
-            guard let url = URL(string: APIAnalytics.url) else {
-                return
-            }
-
-            var request = URLRequest(url: url)
-            request.httpMethod = "POST"
-            request.setValue("application/json", forHTTPHeaderField: "Content-Type")
-            request.httpBody = jsonData
-
-            let _ = try await URLSession.shared.data(for: request)
-
-            await self.track.setEventData(nil)
 
-        } catch {}
+        await self.queue.enqueue(jsonData)
     }
 
-    private func buildPayload() async -> [String: Any] {
-        var identifierVendor = ""
+    package func setUploadGate(_ gate: AnalyticsUploadGate?) async {
+        await self.queue.setUploadGate(gate)
+    }
 
-        await MainActor.run {
-            identifierVendor = self.buyerInfo.getUID()
-        }
+    /// Builds the track of `event` in `context` and serializes it to JSON.
+    ///
+    /// - Returns: The track as JSON, or `nil` when the event data cannot be serialized.
+    package static func encodePayload(for event: AnalyticsEvent, context: AnalyticsContext) -> Data? {
+        let payload = Self.buildPayload(for: event, context: context)
+        return try? JSONSerialization.data(withJSONObject: payload, options: [])
+    }
 
-        let payload: [String: Any] = await [
-            "path": self.track.getPath(),
+    private static func buildPayload(for event: AnalyticsEvent, context: AnalyticsContext) -> [String: Any] {
+        return [
+            "path": event.path,
             "user": [
-                "uid": identifierVendor,
-                "melidata_session_id": await MPAnalyticsConfiguration.shared.sessionID
+                "uid": context.uid,
+                "melidata_session_id": context.sessionID
             ],
-            "type": self.track.getType().rawValue,
+            "type": event.type.rawValue,
             "id": UUID().uuidString,
             "user_time": Int64(Date().timeIntervalSince1970 * 1000),
-            "event_data": self.getEventData(),
+            "event_data": Self.eventData(of: event),
             "application": [
-                "app_name": self.sellerInfo.getBundleIdentifier(),
+                "app_name": context.appName,
                 "business": "mercadopago",
-                "site_id": await MPAnalyticsConfiguration.shared.siteID,
-                "version": await MPAnalyticsConfiguration.shared.version
+                "site_id": context.siteID,
+                "version": context.version
             ],
             "device": [
                 "platform": "/mobile/ios",
-                "connectivity_type": self.buyerInfo.getNetworkType(),
-                "os_version": self.buyerInfo.getiOSVersion()
-            ]
-        ]
-
-        return [
-            "tracks": [
-                payload
+                "connectivity_type": context.connectivityType,
+                "os_version": context.osVersion
             ]
         ]
     }
@@ -292,13 +280,19 @@ package final class MPAnalytics: AnalyticsInterface {
 // MARK: - Private Helpers
 
 private extension MPAnalytics {
-    /// Retrieves the current event data in JSON format.
+    func setContext(_ context: AnalyticsContext) {
+        lock.lock()
+        defer { lock.unlock() }
+        currentContext = context
+    }
+
+    /// Retrieves the event data in JSON format.
     ///
     /// - Returns: Dictionary containing event data or an empty dictionary if no data is present.
-    func getEventData() async -> [String: Any] {
-        var eventData = await track.getEventData()?.toDictionary() ?? [:]
+    static func eventData(of event: AnalyticsEvent) -> [String: Any] {
+        var eventData = event.eventData?.toDictionary() ?? [:]
 
-        if let error = await track.getError() {
+        if let error = event.error {
             eventData["error_type"] = error
         }
 
@@ -0,0 +1,80 @@
+//
+//  AnalyticsContext.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Immutable snapshot of the device and application environment attached to every track.
+///
+/// Built once when analytics is initialized and rebuilt only when the network path changes or
+/// the SDK resolves a new site ID, so sending an event never hops to the main actor nor probes
+/// reachability.
+package final class AnalyticsContext: Sendable {
+    /// Vendor identifier of the device.
+    package let uid: String
+
+    /// Analytics session identifier.
+    package let sessionID: String
+
+    /// Site ID of the app.
+    package let siteID: String
+
+    /// Version of the SDK.
+    package let version: String
+
+    /// Bundle identifier of the host app.
+    package let appName: String
+
+    /// iOS version of the device.
+    package let osVersion: String
+
+    /// Network type (e.g. "wifi", "4g").
+    package let connectivityType: String
+
+    package init(
+        uid: String,
+        sessionID: String,
+        siteID: String,
+        version: String,
+        appName: String,
+        osVersion: String,
+        connectivityType: String
+    ) {
+        self.uid = uid
+        self.sessionID = sessionID
+        self.siteID = siteID
+        self.version = version
+        self.appName = appName
+        self.osVersion = osVersion
+        self.connectivityType = connectivityType
+    }
+
+    /// Returns a copy with an updated network type.
+    func updating(connectivityType: String) -> AnalyticsContext {
+        AnalyticsContext(
+            uid: self.uid,
+            sessionID: self.sessionID,
+            siteID: self.siteID,
+            version: self.version,
+            appName: self.appName,
+            osVersion: self.osVersion,
+            connectivityType: connectivityType
+        )
+    }
+
+    /// Returns a copy with an updated site ID.
+    func updating(siteID: String) -> AnalyticsContext {
+        AnalyticsContext(
+            uid: self.uid,
+            sessionID: self.sessionID,
+            siteID: siteID,
+            version: self.version,
+            appName: self.appName,
+            osVersion: self.osVersion,
+            connectivityType: self.connectivityType
+        )
+    }
+}
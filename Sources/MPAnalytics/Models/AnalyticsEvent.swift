@@ -0,0 +1,68 @@
+//
+//  AnalyticsEvent.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+/// Immutable description of a single track.
+///
+/// Built from `AnalyticsInterface.trackEvent(_:)` or `trackView(_:)`. Every modifier returns a
+/// new value, so events built concurrently never overwrite each other.
+///
+/// Example:
+/// ```swift
+/// await analytics
+///     .trackEvent("payment/credit_card")
+///     .setEventData(paymentData)
+///     .send()
+/// ```
+package struct AnalyticsEvent: Sendable {
+    /// Path identifying the event or view.
+    package let path: String
+
+    /// Type of the tracking (event or view).
+    package let type: TrackType
+
+    /// Custom data attached to the event.
+    package let eventData: (any AnalyticsEventData)?
+
+    /// Error description attached to the event.
+    package let error: String?
+
+    /// Engine the event is submitted to.
+    private let analytics: any AnalyticsInterface
+
+    init(
+        path: String,
+        type: TrackType,
+        eventData: (any AnalyticsEventData)? = nil,
+        error: String? = nil,
+        analytics: any AnalyticsInterface
+    ) {
+        self.path = path
+        self.type = type
+        self.eventData = eventData
+        self.error = error
+        self.analytics = analytics
+    }
+
+    /// Returns a copy carrying `data` as event data.
+    ///
+    /// - Parameter data: Object implementing `AnalyticsEventData` containing event data.
+    package func setEventData(_ data: AnalyticsEventData) -> AnalyticsEvent {
+        AnalyticsEvent(path: self.path, type: self.type, eventData: data, error: self.error, analytics: self.analytics)
+    }
+
+    /// Returns a copy carrying `error`.
+    ///
+    /// - Parameter error: String of error.
+    package func setError(_ error: String) -> AnalyticsEvent {
+        AnalyticsEvent(path: self.path, type: self.type, eventData: self.eventData, error: error, analytics: self.analytics)
+    }
+
+    /// Submits the event to the analytics engine that built it.
+    package func send() async {
+        await self.analytics.send(self)
+    }
+}
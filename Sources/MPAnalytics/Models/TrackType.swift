@@ -6,7 +6,7 @@
 //  Copyright © 2024 Mercado Pago. All rights reserved.
 //
 
-enum TrackType: String {
+package enum TrackType: String, Sendable {
     case view = "View"
     case event = "Event"
 }
@@ -0,0 +1,89 @@
+//
+//  AnalyticsEventStore.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Append-only JSON Lines file holding tracks that were not delivered yet.
+///
+/// Every queued track is appended as one line so a crash or an offline period does not lose it.
+/// The file is compacted only after a batch is delivered.
+///
+/// - Note: Not synchronized; it is owned and serialized by `AnalyticsQueue`.
+package struct AnalyticsEventStore: Sendable {
+    private static let newline = UInt8(ascii: "\n")
+
+    private let fileURL: URL?
+
+    /// Creates a store.
+    /// - Parameter fileURL: File backing the store, or `nil` to keep tracks in memory only.
+    package init(fileURL: URL?) {
+        self.fileURL = fileURL
+    }
+
+    /// Default store located at `Caches/MPAnalytics/pending.jsonl`.
+    package static func makeDefault() -> AnalyticsEventStore {
+        let directory = FileManager.default
+            .urls(for: .cachesDirectory, in: .userDomainMask)
+            .first?
+            .appendingPathComponent("MPAnalytics", isDirectory: true)
+
+        return AnalyticsEventStore(fileURL: directory?.appendingPathComponent("pending.jsonl"))
+    }
+
+    /// Appends a serialized track as a new line.
+    func append(_ event: Data) {
+        guard let fileURL else { return }
+
+        var line = event
+        line.append(Self.newline)
+
+        guard let handle = try? FileHandle(forWritingTo: fileURL) else {
+            self.write(line, to: fileURL)
+            return
+        }
+        defer { try? handle.close() }
+
+        handle.seekToEndOfFile()
+        handle.write(line)
+    }
+
+    /// Reads every pending track, skipping empty lines.
+    func load() -> [Data] {
+        guard let fileURL, let contents = try? Data(contentsOf: fileURL) else {
+            return []
+        }
+
+        return contents
+            .split(separator: Self.newline)
+            .map { Data($0) }
+    }
+
+    /// Replaces the file contents with `events`, removing it when nothing is left.
+    func replace(with events: [Data]) {
+        guard let fileURL else { return }
+
+        guard !events.isEmpty else {
+            try? FileManager.default.removeItem(at: fileURL)
+            return
+        }
+
+        var contents = Data()
+        for event in events {
+            contents.append(event)
+            contents.append(Self.newline)
+        }
+        self.write(contents, to: fileURL)
+    }
+
+    private func write(_ data: Data, to fileURL: URL) {
+        try? FileManager.default.createDirectory(
+            at: fileURL.deletingLastPathComponent(),
+            withIntermediateDirectories: true
+        )
+        try? data.write(to: fileURL, options: .atomic)
+    }
+}
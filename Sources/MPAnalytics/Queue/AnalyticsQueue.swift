@@ -0,0 +1,258 @@
+//
+//  AnalyticsQueue.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+#if canImport(UIKit)
+    import UIKit
+#endif
+
+/// Buffers serialized tracks and delivers them in batches.
+///
+/// Instead of one POST per track, tracks are appended to a bounded buffer and flushed as a
+/// single `{"tracks":[...]}` envelope when the buffer reaches `maximumBatchSize`, when
+/// `flushInterval` elapses or when `flush()` is called explicitly (e.g. on app background).
+/// Pending tracks are persisted through `AnalyticsEventStore`, and failed uploads are retried
+/// with exponential backoff unless the backend rejected the batch itself.
+///
+/// Example:
+/// ```swift
+/// let queue = AnalyticsQueue(store: .makeDefault())
+/// await queue.enqueue(trackData)
+/// ```
+package actor AnalyticsQueue {
+    /// Limits applied to buffering and retries.
+    package struct Configuration: Sendable {
+        /// Tracks per request; reaching it triggers an immediate flush.
+        package let maximumBatchSize: Int
+
+        /// Maximum time, in seconds, a track waits in the buffer.
+        package let flushInterval: TimeInterval
+
+        /// Maximum number of pending tracks kept; the oldest are dropped beyond it.
+        package let maximumPendingEvents: Int
+
+        /// Delay, in seconds, before the first retry. Doubles on every consecutive failure.
+        package let initialRetryDelay: TimeInterval
+
+        /// Upper bound, in seconds, of the retry delay.
+        package let maximumRetryDelay: TimeInterval
+
+        package static let `default` = Configuration()
+
+        package init(
+            maximumBatchSize: Int = 20,
+            flushInterval: TimeInterval = 10,
+            maximumPendingEvents: Int = 500,
+            initialRetryDelay: TimeInterval = 2,
+            maximumRetryDelay: TimeInterval = 120
+        ) {
+            self.maximumBatchSize = maximumBatchSize
+            self.flushInterval = flushInterval
+            self.maximumPendingEvents = maximumPendingEvents
+            self.initialRetryDelay = initialRetryDelay
+            self.maximumRetryDelay = maximumRetryDelay
+        }
+    }
+
+    /// Queue shared by every `MPAnalytics` instance. Flushes when the app moves to background.
+    package static let shared: AnalyticsQueue = {
+        let queue = AnalyticsQueue(store: .makeDefault())
+        queue.flushOnApplicationBackground()
+        return queue
+    }()
+
+    private let uploader: AnalyticsUploading
+    private var uploadGate: AnalyticsUploadGate?
+    private let store: AnalyticsEventStore
+    private let configuration: Configuration
+
+    private var pending: [Data] = []
+
+    /// Sequence number of `pending[0]`: the count of tracks ever removed from the front, so a
+    /// flush can tell which tracks of its batch were trimmed while it was uploading.
+    private var headSequence = 0
+    private var didRestore = false
+    private var isFlushing = false
+    private var consecutiveFailures = 0
+    private var scheduledFlush: Task<Void, Never>?
+
+    package init(
+        uploader: AnalyticsUploading = AnalyticsUploader(),
+        store: AnalyticsEventStore,
+        configuration: Configuration = .default
+    ) {
+        self.uploader = uploader
+        self.store = store
+        self.configuration = configuration
+    }
+
+    /// Number of tracks waiting to be delivered.
+    package var pendingCount: Int {
+        self.restoreIfNeeded()
+        return self.pending.count
+    }
+
+    /// Routes the next uploads through `gate`, or sends them directly with `nil`.
+    package func setUploadGate(_ gate: AnalyticsUploadGate?) {
+        self.uploadGate = gate
+    }
+
+    /// Adds a serialized track to the buffer.
+    ///
+    /// - Parameter event: JSON object of a single track.
+    package func enqueue(_ event: Data) async {
+        self.restoreIfNeeded()
+
+        self.pending.append(event)
+        self.store.append(event)
+        self.trimIfNeeded()
+
+        // While backing off, the retry timer owns the next attempt.
+        if self.pending.count >= self.configuration.maximumBatchSize, self.consecutiveFailures == 0 {
+            await self.flush()
+        } else {
+            self.scheduleFlush(after: self.configuration.flushInterval)
+        }
+    }
+
+    /// Delivers every pending track, one batch per request.
+    ///
+    /// Stops at the first failed batch and schedules a retry with backoff. A batch rejected
+    /// with a non-retryable error is dropped so it never blocks the tracks behind it.
+    package func flush() async {
+        self.restoreIfNeeded()
+
+        guard !self.isFlushing else { return }
+        self.isFlushing = true
+        defer { self.isFlushing = false }
+
+        self.scheduledFlush?.cancel()
+        self.scheduledFlush = nil
+
+        while !self.pending.isEmpty {
+            let batch = Array(self.pending.prefix(self.configuration.maximumBatchSize))
+            let batchEnd = self.headSequence + batch.count
+
+            do {
+                try await self.upload(Self.makeEnvelope(batch))
+            } catch let error as AnalyticsUploadError where !error.isRetryable {
+                // Dropped like an uploaded batch below.
+            } catch {
+                self.consecutiveFailures += 1
+                self.scheduleFlush(after: self.retryDelay())
+                return
+            }
+
+            // Tracks enqueued during the upload were appended after `batch`, and trimming may
+            // have dropped the start of `batch`: only its tracks still pending are removed.
+            self.removeFirst(min(max(batchEnd - self.headSequence, 0), self.pending.count))
+            self.store.replace(with: self.pending)
+            self.consecutiveFailures = 0
+        }
+    }
+
+    /// Builds the `{"tracks":[...]}` envelope by splicing already serialized tracks.
+    static func makeEnvelope(_ events: [Data]) -> Data {
+        var body = Data("{\"tracks\":[".utf8)
+        body.reserveCapacity(events.reduce(body.count + 2) { $0 + $1.count + 1 })
+
+        for (index, event) in events.enumerated() {
+            if index > 0 {
+                body.append(UInt8(ascii: ","))
+            }
+            body.append(event)
+        }
+
+        body.append(contentsOf: Array("]}".utf8))
+        return body
+    }
+}
+
+// MARK: - Application Lifecycle
+
+extension AnalyticsQueue {
+    /// Flushes pending tracks whenever the app enters background.
+    ///
+    /// Tracks are already persisted, so a flush cut short by suspension is retried on next launch.
+    nonisolated func flushOnApplicationBackground() {
+        #if canImport(UIKit)
+            NotificationCenter.default.addObserver(
+                forName: UIApplication.didEnterBackgroundNotification,
+                object: nil,
+                queue: nil
+            ) { [weak self] _ in
+                guard let self else { return }
+                Task { await self.flush() }
+            }
+        #endif
+    }
+}
+
+// MARK: - Private Methods
+
+private extension AnalyticsQueue {
+    func restoreIfNeeded() {
+        guard !self.didRestore else { return }
+        self.didRestore = true
+
+        let restored = self.store.load()
+        guard !restored.isEmpty else { return }
+
+        self.pending.insert(contentsOf: restored, at: 0)
+        self.trimIfNeeded()
+        self.scheduleFlush(after: 0)
+    }
+
+    func trimIfNeeded() {
+        let overflow = self.pending.count - self.configuration.maximumPendingEvents
+        guard overflow > 0 else { return }
+
+        self.removeFirst(overflow)
+        self.store.replace(with: self.pending)
+    }
+
+    func removeFirst(_ count: Int) {
+        self.pending.removeFirst(count)
+        self.headSequence += count
+    }
+
+    func upload(_ envelope: Data) async throws {
+        guard let uploadGate = self.uploadGate else {
+            return try await self.uploader.upload(envelope)
+        }
+
+        let uploader = self.uploader
+        try await uploadGate.perform {
+            try await uploader.upload(envelope)
+        }
+    }
+
+    /// Exponential backoff with up to 20% jitter, capped at `maximumRetryDelay`.
+    func retryDelay() -> TimeInterval {
+        let exponent = Double(min(self.consecutiveFailures - 1, 16))
+        let delay = min(
+            self.configuration.initialRetryDelay * pow(2, exponent),
+            self.configuration.maximumRetryDelay
+        )
+        return delay + delay * Double.random(in: 0 ... 0.2)
+    }
+
+    func scheduleFlush(after delay: TimeInterval) {
+        guard self.scheduledFlush == nil else { return }
+
+        self.scheduledFlush = Task { [weak self] in
+            try? await Task.sleep(nanoseconds: UInt64(max(delay, 0) * 1_000_000_000))
+            guard !Task.isCancelled, let self else { return }
+            await self.runScheduledFlush()
+        }
+    }
+
+    func runScheduledFlush() async {
+        self.scheduledFlush = nil
+        await self.flush()
+    }
+}
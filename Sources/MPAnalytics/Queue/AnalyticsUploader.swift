@@ -0,0 +1,69 @@
+//
+//  AnalyticsUploader.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Delivers a batch of serialized tracks to the analytics backend.
+package protocol AnalyticsUploading: Sendable {
+    /// Uploads a `{"tracks":[...]}` envelope.
+    ///
+    /// - Parameter body: JSON body holding one or more tracks.
+    /// - Throws: When the batch was not accepted. A non-retryable `AnalyticsUploadError` drops
+    ///   the batch; any other error keeps it for a retry.
+    func upload(_ body: Data) async throws
+}
+
+/// Admits track uploads into a shared request schedule, e.g. the SDK background lane,
+/// so analytics never competes with payment requests for connections.
+package protocol AnalyticsUploadGate: Sendable {
+    /// Runs `upload` once the gate admits it.
+    ///
+    /// - Throws: The error of `upload`, or an error when the upload was never admitted.
+    func perform(_ upload: () async throws -> Void) async throws
+}
+
+/// Errors raised by `AnalyticsUploader`.
+package enum AnalyticsUploadError: Error, Equatable {
+    case invalidURL
+    case statusCode(Int)
+
+    /// Whether the same batch may be accepted later. Client errors other than 408 and 429
+    /// (e.g. 400 or 413) reject the batch itself, so sending it again can never succeed.
+    package var isRetryable: Bool {
+        guard case let .statusCode(statusCode) = self, (400 ... 499).contains(statusCode) else {
+            return true
+        }
+        return statusCode == 408 || statusCode == 429
+    }
+}
+
+/// Posts track batches to the Mercado Libre tracks API.
+package struct AnalyticsUploader: AnalyticsUploading {
+    private let url: String
+
+    package init(url: String = "https://api.mercadolibre.com/tracks") {
+        self.url = url
+    }
+
+    package func upload(_ body: Data) async throws {
+        guard let url = URL(string: self.url) else {
+            throw AnalyticsUploadError.invalidURL
+        }
+
+        var request = URLRequest(url: url)
+        request.httpMethod = "POST"
+        request.setValue("application/json", forHTTPHeaderField: "Content-Type")
+        request.httpBody = body
+
+        let (_, response) = try await URLSession.shared.data(for: request)
+
+        if let httpResponse = response as? HTTPURLResponse,
+           !(200 ... 299).contains(httpResponse.statusCode) {
+            throw AnalyticsUploadError.statusCode(httpResponse.statusCode)
+        }
+    }
+}
@@ -79,4 +79,21 @@ extension ApplePayEndpoint: RequestEndpoint {
             return httpBody
         }
     }
+
+    /// Retry policy. Tokenization carries an idempotency key so a retry after a timeout
+    /// cannot create a second token.
+    var retryPolicy: RetryPolicy {
+        switch self {
+        case .postToken:
+            return .default.idempotent()
+        }
+    }
+
+    /// Scheduler lane. Tokenization runs after the user authorized the payment.
+    var priority: RequestPriority {
+        switch self {
+        case .postToken:
+            return .critical
+        }
+    }
 } 
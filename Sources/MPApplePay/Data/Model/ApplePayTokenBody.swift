@@ -6,6 +6,9 @@
 //
 import Foundation
 import PassKit
+#if SWIFT_PACKAGE
+    import MPCore
+#endif
 
 /// Request body for Apple Pay tokenization endpoint.
 struct ApplePayRequestBody {
@@ -35,22 +38,23 @@ struct ApplePayRequestBody {
 extension ApplePayRequestBody {
     /// Converts the `ApplePayRequestBody` data to JSON format for use in a request body.
     ///
-    /// - Returns: A `Data` object representing the post data in JSON format, or `nil` if the conversion fails.
+    /// The body is written straight into a buffer sized for the payment data and the device
+    /// fingerprint, whose already encoded JSON is spliced in as is.
+    ///
+    /// - Returns: A `Data` object representing the post data in JSON format.
     func toJSONData() -> Data? {
-        let payment: [String: String] = [
-            "type": paymentMethod.type,
-            "payment_data": paymentMethod.paymentData
-        ]
-        
-        var jsonObject: [String: Any] = [
-            "payment_method": payment as Any,
-            "transaction_identifier": transactionIdentifier as Any,
-        ]
-        
-        if let deviceObject = try? JSONSerialization.jsonObject(with: device, options: []) as? [String: Any] {
-            jsonObject["device"] = deviceObject
-        }
+        var writer = JSONWriter(capacity: 128 + self.paymentMethod.paymentData.utf8.count + self.device.count)
+
+        writer.beginObject()
+        writer.key("payment_method")
+        writer.beginObject()
+        writer.field("type", self.paymentMethod.type)
+        writer.field("payment_data", self.paymentMethod.paymentData)
+        writer.endObject()
+        writer.field("transaction_identifier", self.transactionIdentifier)
+        writer.rawField("device", self.device)
+        writer.endObject()
 
-        return try? JSONSerialization.data(withJSONObject: jsonObject, options: [])
+        return writer.data
     }
 }
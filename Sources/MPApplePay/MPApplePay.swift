@@ -27,7 +27,7 @@ public final class MPApplePay: Sendable {
     
     private let useCase: ApplePayUseCaseProtocol
     
-    typealias Dependency = HasAnalytics
+    typealias Dependency = HasAnalytics & HasSiteIDProvider
     let dependencies: Dependency
     
     struct Analytics {
@@ -127,8 +127,12 @@ extension MPApplePay {
     /// - Returns: A `MPApplePayToken` with an identifier and BIN information when available.
     /// - Throws: Errors originating from the underlying network request or response decoding.
     public func createToken(_ paymentToken: PKPaymentToken, status: String? = nil) async throws -> MPApplePayToken {
+        self.dependencies.siteIDProvider.startIfNeeded()
+
         do {
-            let token = try await useCase.createToken(paymentToken, status: status)
+            let token = try await MPMetrics.shared.measure("apple_pay.create_token") {
+                try await useCase.createToken(paymentToken, status: status)
+            }
             
             Task.detached {
                 await self.dependencies.analytics
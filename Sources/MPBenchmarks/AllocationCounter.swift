@@ -0,0 +1,55 @@
+//
+//  AllocationCounter.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Darwin
+
+/// Counts heap allocations through the `malloc_logger` hook of libmalloc, which is called on
+/// every allocation of every malloc zone while it is set.
+///
+/// The count is not atomic, so allocations made at the same time by other threads may be
+/// missed. Benchmarks run their body on the calling thread only.
+enum AllocationCounter {
+    private typealias Logger = @convention(c) (UInt32, UInt, UInt, UInt, UInt, UInt32) -> Void
+
+    private nonisolated(unsafe) static var allocations = 0
+
+    /// Address of `malloc_logger`, or `nil` when libmalloc does not export it.
+    private nonisolated(unsafe) static let hook: UnsafeMutablePointer<Logger?>? = {
+        // RTLD_DEFAULT
+        guard let symbol = dlsym(UnsafeMutableRawPointer(bitPattern: -2), "malloc_logger") else {
+            return nil
+        }
+        return symbol.assumingMemoryBound(to: Logger?.self)
+    }()
+
+    /// Whether allocations can be counted in this process.
+    static var isAvailable: Bool {
+        self.hook != nil
+    }
+
+    /// Runs `operation` and returns the number of heap allocations it made.
+    static func count(_ operation: () -> Void) -> Int {
+        guard let hook = self.hook else {
+            operation()
+            return 0
+        }
+
+        let previous = hook.pointee
+        self.allocations = 0
+        hook.pointee = { type, _, _, _, _, _ in
+            // MALLOC_LOG_TYPE_ALLOCATE, also set on reallocations. A literal, so the hook never
+            // runs a lazy initializer from inside malloc.
+            if type & 2 != 0 {
+                AllocationCounter.allocations &+= 1
+            }
+        }
+        operation()
+        hook.pointee = previous
+
+        return self.allocations
+    }
+}
@@ -0,0 +1,62 @@
+//
+//  Baseline.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Results saved by `--save` and compared against by `--compare`.
+struct Baseline: Codable {
+    let results: [BenchmarkResult]
+
+    init(results: [BenchmarkResult]) {
+        self.results = results
+    }
+
+    init(contentsOf url: URL) throws {
+        self = try JSONDecoder().decode(Baseline.self, from: Data(contentsOf: url))
+    }
+
+    func write(to url: URL) throws {
+        let encoder = JSONEncoder()
+        encoder.outputFormatting = [.prettyPrinted, .sortedKeys]
+        try encoder.encode(self).write(to: url, options: .atomic)
+    }
+
+    subscript(name: String) -> BenchmarkResult? {
+        self.results.first { $0.name == name }
+    }
+}
+
+/// Difference between a result and its baseline.
+struct BenchmarkComparison {
+    /// Footprint growth below this many bytes is treated as noise.
+    static let memoryNoiseBytes: UInt64 = 64 * 1024
+
+    let current: BenchmarkResult
+    let baseline: BenchmarkResult
+
+    /// Change of the median wall time, in percent.
+    var timeChange: Double {
+        guard self.baseline.medianNanoseconds > 0 else { return 0 }
+        return (self.current.medianNanoseconds - self.baseline.medianNanoseconds) / self.baseline.medianNanoseconds * 100
+    }
+
+    /// Change of the allocations per run.
+    var allocationChange: Double {
+        self.current.allocations - self.baseline.allocations
+    }
+
+    /// Whether the benchmark got slower than `threshold` percent, allocates more, or grew its
+    /// footprint by more than `threshold` percent.
+    func isRegression(threshold: Double) -> Bool {
+        let memoryGrowth = self.current.peakMemoryBytes.subtractingReportingOverflow(self.baseline.peakMemoryBytes)
+        let isMemoryRegression = !memoryGrowth.overflow
+            && memoryGrowth.partialValue > Self.memoryNoiseBytes
+            && Double(memoryGrowth.partialValue) > Double(self.baseline.peakMemoryBytes) * threshold / 100
+
+        return self.timeChange > threshold || self.allocationChange >= 0.5 || isMemoryRegression
+    }
+}
@@ -0,0 +1,52 @@
+//
+//  Benchmark.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// A hot path of the SDK measured by `MPBenchmarks`.
+struct Benchmark {
+    /// Stable identifier used in reports and baselines, e.g. `string.only_numbers`.
+    let name: String
+
+    /// Times `body` runs per sample. Short operations use large batches so each sample lasts
+    /// well above the clock resolution.
+    let batch: Int
+
+    /// One run of the measured operation. Results must go through `blackHole(_:)` so the
+    /// optimizer cannot drop the work.
+    let body: () -> Void
+
+    init(_ name: String, batch: Int = 1000, body: @escaping () -> Void) {
+        self.name = name
+        self.batch = batch
+        self.body = body
+    }
+}
+
+/// Measurements of one benchmark, per run of its body.
+struct BenchmarkResult: Codable {
+    let name: String
+
+    /// Median wall time, in nanoseconds.
+    let medianNanoseconds: Double
+
+    /// 90th percentile wall time, in nanoseconds.
+    let p90Nanoseconds: Double
+
+    /// Heap allocations.
+    let allocations: Double
+
+    /// Largest growth of the physical footprint while the benchmark ran, in bytes.
+    let peakMemoryBytes: UInt64
+}
+
+/// Keeps `value` alive so the optimizer cannot remove the computation producing it.
+@inline(never)
+@_optimize(none)
+func blackHole<T>(_ value: T) {
+    _ = value
+}
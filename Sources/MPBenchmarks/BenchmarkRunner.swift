@@ -0,0 +1,66 @@
+//
+//  BenchmarkRunner.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Runs benchmarks one after the other on the calling thread.
+///
+/// Each benchmark is warmed up with one batch, then timed over `samples` batches. Allocations
+/// are counted on a separate batch, so the allocation hook does not skew the wall time.
+struct BenchmarkRunner {
+    /// Timed batches per benchmark.
+    let samples: Int
+
+    func run(_ benchmark: Benchmark) -> BenchmarkResult {
+        let baselineFootprint = MemoryFootprint.current()
+        var peakFootprint = baselineFootprint
+
+        self.runBatch(of: benchmark)
+
+        var durations: [Double] = []
+        durations.reserveCapacity(self.samples)
+        for _ in 0 ..< self.samples {
+            let start = DispatchTime.now().uptimeNanoseconds
+            self.runBatch(of: benchmark)
+            let end = DispatchTime.now().uptimeNanoseconds
+
+            durations.append(Double(end - start) / Double(benchmark.batch))
+            peakFootprint = max(peakFootprint, MemoryFootprint.current())
+        }
+        durations.sort()
+
+        let allocations = AllocationCounter.count {
+            self.runBatch(of: benchmark)
+        }
+
+        return BenchmarkResult(
+            name: benchmark.name,
+            medianNanoseconds: Self.percentile(0.5, of: durations),
+            p90Nanoseconds: Self.percentile(0.9, of: durations),
+            allocations: Double(allocations) / Double(benchmark.batch),
+            peakMemoryBytes: peakFootprint - baselineFootprint
+        )
+    }
+}
+
+// MARK: - Private Methods
+
+private extension BenchmarkRunner {
+    func runBatch(of benchmark: Benchmark) {
+        for _ in 0 ..< benchmark.batch {
+            benchmark.body()
+        }
+    }
+
+    /// Nearest-rank percentile of sorted `values`.
+    static func percentile(_ percentile: Double, of values: [Double]) -> Double {
+        guard !values.isEmpty else { return 0 }
+
+        let rank = Int((percentile * Double(values.count)).rounded(.up))
+        return values[min(max(rank, 1), values.count) - 1]
+    }
+}
@@ -0,0 +1,51 @@
+//
+//  AnalyticsBenchmarks.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import MPAnalytics
+
+/// Track building done for every tracked SDK call.
+extension Benchmark {
+    static var analytics: [Benchmark] {
+        let context = AnalyticsContext(
+            uid: "4D8E6F1A-6B0C-4F7C-9C2B-2E1B7C9B1D30",
+            sessionID: "0F3C2B7E-1A2D-4E5F-8A9B-7C6D5E4F3A2B",
+            siteID: "MLB",
+            version: "1.0.0",
+            appName: "com.mercadopago.benchmarks",
+            osVersion: "17.4",
+            connectivityType: "wifi"
+        )
+        let event = MPAnalytics.shared
+            .trackEvent("/checkout_api_native/core_methods/payment_methods")
+            .setEventData(PaymentMethodEventData(issuer: 24, paymentType: "credit_card", sizeSecurityCode: 3, cardBrand: "master"))
+
+        return [
+            Benchmark("analytics.encode_payload", batch: 200) {
+                blackHole(MPAnalytics.encodePayload(for: event, context: context))
+            }
+        ]
+    }
+}
+
+// MARK: - Fixtures
+
+/// Copy of the `CoreMethods` payment method event data, which is internal to `CoreMethods`.
+private struct PaymentMethodEventData: AnalyticsEventData {
+    let issuer: Int
+    let paymentType: String
+    let sizeSecurityCode: Int
+    let cardBrand: String
+
+    func toDictionary() -> [String: any Sendable] {
+        return [
+            "card_brand": self.cardBrand,
+            "issuer": "\(self.issuer)",
+            "payment_type": self.paymentType,
+            "security_length": "\(self.sizeSecurityCode)"
+        ]
+    }
+}
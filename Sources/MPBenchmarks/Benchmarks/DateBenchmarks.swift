@@ -0,0 +1,47 @@
+//
+//  DateBenchmarks.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+import MPCore
+
+/// `FixedDateParser` against the `DateFormatter` paths it replaced.
+extension Benchmark {
+    static var dates: [Benchmark] {
+        let timeFrameDate = "2025-03-07T00:00:00.000-0400"
+        let expirationDate = "11/30"
+        let clock = SystemYearMonthClock.shared
+
+        let isoFormatter = DateFormatter()
+        isoFormatter.dateFormat = "yyyy-MM-dd'T'HH:mm:ss.SSSZ"
+
+        return [
+            Benchmark("date.iso8601.date_formatter") {
+                blackHole(isoFormatter.date(from: timeFrameDate))
+            },
+            Benchmark("date.iso8601.fixed_parser") {
+                blackHole(FixedDateParser.date(iso8601: timeFrameDate))
+            },
+            Benchmark("date.expiration.date_formatter", batch: 100) {
+                // Previous `Calendar.dateFromExpiration`: a formatter per call.
+                let formatter = DateFormatter()
+                formatter.dateFormat = "MM/yyyy"
+                blackHole(formatter.date(from: "11/2030"))
+            },
+            Benchmark("date.expiration.fixed_parser") {
+                blackHole(FixedDateParser.expiration(expirationDate, century: clock.current.century))
+            },
+            Benchmark("date.current_month.calendar") {
+                let calendar = Calendar.current
+                let now = Date()
+                blackHole((calendar.component(.year, from: now), calendar.component(.month, from: now)))
+            },
+            Benchmark("date.current_month.clock") {
+                blackHole(clock.current)
+            }
+        ]
+    }
+}
@@ -0,0 +1,39 @@
+//
+//  DecodingBenchmarks.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import CoreMethods
+import Foundation
+
+/// Decoding of recorded catalog responses straight into the public models.
+extension Benchmark {
+    static var decoding: [Benchmark] {
+        let paymentMethods = Self.fixture("payment_methods")
+        let installments = Self.fixture("installments")
+
+        return [
+            Benchmark("decoding.payment_methods", batch: 50) {
+                blackHole(try? JSONDecoder().decode(DecodedModelList<DecodedPaymentMethod>.self, from: paymentMethods).models)
+            },
+            Benchmark("decoding.installments", batch: 20) {
+                blackHole(try? JSONDecoder().decode(DecodedModelList<DecodedInstallment>.self, from: installments).models)
+            }
+        ]
+    }
+}
+
+// MARK: - Fixtures
+
+private extension Benchmark {
+    /// Recorded response in `Fixtures/<name>.json`.
+    static func fixture(_ name: String) -> Data {
+        guard let url = Bundle.module.url(forResource: name, withExtension: "json", subdirectory: "Fixtures"),
+              let data = try? Data(contentsOf: url) else {
+            fatalError("Missing fixture \(name).json")
+        }
+        return data
+    }
+}
@@ -0,0 +1,33 @@
+//
+//  FieldBenchmarks.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import CoreMethods
+import MPCore
+
+/// Work done by the card fields on every keystroke.
+extension Benchmark {
+    static var fields: [Benchmark] {
+        let cardNumber = "4509 9535 6623 3704"
+        let cardNumberValidation = CardNumberValidation(maxLength: 16)
+        let expirationDateValidation = ExpirationDateValidation()
+
+        return [
+            Benchmark("string.only_numbers") {
+                blackHole(cardNumber.onlyNumbers())
+            },
+            Benchmark("string.apply_mask") {
+                blackHole(cardNumber.applyMask("#### #### #### ####", separator: " "))
+            },
+            Benchmark("validation.card_number") {
+                blackHole(cardNumberValidation.isValid(cardNumber))
+            },
+            Benchmark("validation.expiration_date") {
+                blackHole(expirationDateValidation.isValid("11/30"))
+            }
+        ]
+    }
+}
@@ -0,0 +1,82 @@
+//
+//  NetworkBenchmarks.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import CoreMethods
+import Foundation
+import MPCore
+
+/// Request building of the BIN lookups and the tokenization.
+extension Benchmark {
+    static var network: [Benchmark] {
+        let body = CardTokenBody(
+            cardNumber: "5031433215406351",
+            expirationMonth: "11",
+            expirationYear: "2030",
+            securityCode: "123",
+            requireEsc: true,
+            buyerIdentification: BuyerIdentification(name: "APRO", number: "12345678909", type: "CPF"),
+            device: Self.makeDevice()
+        )
+        let lookup = BenchmarkEndpoint(
+            method: .get,
+            path: "installments",
+            urlParams: ["bin": "50314332", "amount": "1000.0", "product_id": "coremethods"],
+            body: nil
+        )
+        let tokenization = BenchmarkEndpoint(method: .post, path: "card_tokens", urlParams: [:], body: body.toJSONData())
+
+        return [
+            Benchmark("endpoint.url_request.get") {
+                blackHole(lookup.urlRequest)
+            },
+            Benchmark("endpoint.url_request.post") {
+                blackHole(tokenization.urlRequest)
+            },
+            Benchmark("card_token_body.to_json_data", batch: 200) {
+                blackHole(body.toJSONData())
+            }
+        ]
+    }
+}
+
+// MARK: - Fixtures
+
+/// Endpoint shaped like `CoreMethodsEndpoint`, which is internal to `CoreMethods`.
+private struct BenchmarkEndpoint: RequestEndpoint {
+    let method: HTTPMethod
+    let path: String
+    let urlParams: [String: any CustomStringConvertible]
+    let body: Data?
+
+    var baseURL: String { "https://api.mercadopago.com" }
+
+    var headers: [String: String] { ["Content-Type": "application/json"] }
+
+    var apiVersion: APIVersion { .v1 }
+}
+
+private extension Benchmark {
+    /// Fingerprint shaped like `Device.getInfoAsJsonData()`, about 3 KB.
+    static func makeDevice() -> Data {
+        var vendorSpecific: [String: Any] = [:]
+        for index in 0 ..< 60 {
+            vendorSpecific["property_\(index)"] = "value-\(index)-\(UUID().uuidString)"
+        }
+        let object: [String: Any] = [
+            "fingerprint": [
+                "os": "iOS",
+                "system_version": "17.4",
+                "ram": 6_442_450_944,
+                "disk_space": 127_989_493_760,
+                "model": "iPhone15,2",
+                "vendor_ids": [["name": "vendor_id", "value": UUID().uuidString]],
+                "vendor_specific_attributes": vendorSpecific
+            ]
+        ]
+        return (try? JSONSerialization.data(withJSONObject: object)) ?? Data()
+    }
+}
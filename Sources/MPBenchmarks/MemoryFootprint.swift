@@ -0,0 +1,24 @@
+//
+//  MemoryFootprint.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Darwin
+
+enum MemoryFootprint {
+    /// Physical footprint of the process in bytes, the value shown by the Xcode memory gauge.
+    static func current() -> UInt64 {
+        var info = task_vm_info_data_t()
+        var count = mach_msg_type_number_t(MemoryLayout<task_vm_info_data_t>.size / MemoryLayout<natural_t>.size)
+
+        let result = withUnsafeMutablePointer(to: &info) { pointer in
+            pointer.withMemoryRebound(to: integer_t.self, capacity: Int(count)) { info in
+                task_info(mach_task_self_, task_flavor_t(TASK_VM_INFO), info, &count)
+            }
+        }
+
+        return result == KERN_SUCCESS ? info.phys_footprint : 0
+    }
+}
@@ -0,0 +1,72 @@
+//
+//  Report.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Plain-text table of the results.
+enum Report {
+    private static let nameWidth = 32
+
+    static func header(comparing: Bool) -> String {
+        var columns = [
+            Self.pad("benchmark", to: Self.nameWidth),
+            Self.pad("time/op", to: 12),
+            Self.pad("p90", to: 12),
+            Self.pad("allocs/op", to: 10),
+            Self.pad("peak", to: 10)
+        ]
+        if comparing {
+            columns += [Self.pad("Δ time", to: 10), Self.pad("Δ allocs", to: 10)]
+        }
+        return columns.joined(separator: " ")
+    }
+
+    static func row(_ result: BenchmarkResult, comparison: BenchmarkComparison?, threshold: Double) -> String {
+        var columns = [
+            Self.pad(result.name, to: Self.nameWidth),
+            Self.pad(Self.duration(result.medianNanoseconds), to: 12),
+            Self.pad(Self.duration(result.p90Nanoseconds), to: 12),
+            Self.pad(String(format: "%.1f", result.allocations), to: 10),
+            Self.pad(Self.bytes(result.peakMemoryBytes), to: 10)
+        ]
+        if let comparison {
+            columns += [
+                Self.pad(String(format: "%+.1f%%", comparison.timeChange), to: 10),
+                Self.pad(String(format: "%+.1f", comparison.allocationChange), to: 10)
+            ]
+            if comparison.isRegression(threshold: threshold) {
+                columns.append("REGRESSION")
+            }
+        }
+        return columns.joined(separator: " ")
+    }
+}
+
+// MARK: - Private Methods
+
+private extension Report {
+    static func pad(_ text: String, to width: Int) -> String {
+        text.count >= width ? text : text + String(repeating: " ", count: width - text.count)
+    }
+
+    static func duration(_ nanoseconds: Double) -> String {
+        switch nanoseconds {
+        case ..<1000:
+            return String(format: "%.0f ns", nanoseconds)
+        case ..<1_000_000:
+            return String(format: "%.2f µs", nanoseconds / 1000)
+        default:
+            return String(format: "%.2f ms", nanoseconds / 1_000_000)
+        }
+    }
+
+    static func bytes(_ bytes: UInt64) -> String {
+        bytes < 1024 * 1024
+            ? String(format: "%.0f KB", Double(bytes) / 1024)
+            : String(format: "%.1f MB", Double(bytes) / 1024 / 1024)
+    }
+}
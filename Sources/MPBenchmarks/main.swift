@@ -0,0 +1,100 @@
+//
+//  main.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+// Benchmarks of the SDK hot paths. Run `scripts/run-benchmarks.sh`, which builds this target in
+// release for the iOS Simulator and runs it headless.
+//
+// Options:
+//   --filter <text>        Runs only benchmarks whose name contains `text`.
+//   --samples <count>      Timed batches per benchmark. Defaults to 50.
+//   --save <path>          Writes the results as a baseline.
+//   --compare <path>       Compares against a baseline; exits with 1 on regressions.
+//   --threshold <percent>  Slowdown reported as a regression. Defaults to 10.
+
+struct Options {
+    var filter: String?
+    var samples = 50
+    var savePath: String?
+    var comparePath: String?
+    var threshold: Double = 10
+
+    init(arguments: [String]) {
+        var iterator = arguments.makeIterator()
+        while let argument = iterator.next() {
+            switch argument {
+            case "--filter":
+                self.filter = iterator.next()
+            case "--samples":
+                self.samples = iterator.next().flatMap(Int.init).map { max($0, 1) } ?? self.samples
+            case "--save":
+                self.savePath = iterator.next()
+            case "--compare":
+                self.comparePath = iterator.next()
+            case "--threshold":
+                self.threshold = iterator.next().flatMap(Double.init) ?? self.threshold
+            default:
+                Self.exit(withUsage: "Unknown option \(argument)")
+            }
+        }
+    }
+
+    static func exit(withUsage message: String) -> Never {
+        print(message)
+        print("Usage: MPBenchmarks [--filter <text>] [--samples <count>] [--save <path>] [--compare <path>] [--threshold <percent>]")
+        Foundation.exit(2)
+    }
+}
+
+let options = Options(arguments: Array(CommandLine.arguments.dropFirst()))
+
+let baseline: Baseline?
+do {
+    baseline = try options.comparePath.map { try Baseline(contentsOf: URL(fileURLWithPath: $0)) }
+} catch {
+    Options.exit(withUsage: "Cannot read baseline: \(error)")
+}
+
+let benchmarks = (Benchmark.fields + Benchmark.dates + Benchmark.network + Benchmark.decoding + Benchmark.analytics)
+    .filter { benchmark in options.filter.map { benchmark.name.contains($0) } ?? true }
+
+if !AllocationCounter.isAvailable {
+    print("malloc_logger is unavailable: allocations are reported as 0.")
+}
+
+let runner = BenchmarkRunner(samples: options.samples)
+var results: [BenchmarkResult] = []
+var regressions: [String] = []
+
+print(Report.header(comparing: baseline != nil))
+for benchmark in benchmarks {
+    let result = runner.run(benchmark)
+    results.append(result)
+
+    let comparison = baseline?[result.name].map { BenchmarkComparison(current: result, baseline: $0) }
+    print(Report.row(result, comparison: comparison, threshold: options.threshold))
+
+    if comparison?.isRegression(threshold: options.threshold) == true {
+        regressions.append(result.name)
+    }
+}
+
+if let savePath = options.savePath {
+    do {
+        try Baseline(results: results).write(to: URL(fileURLWithPath: savePath))
+        print("\nBaseline saved to \(savePath)")
+    } catch {
+        print("\nCannot save baseline: \(error)")
+        exit(2)
+    }
+}
+
+if !regressions.isEmpty {
+    print("\nRegressions: \(regressions.joined(separator: ", "))")
+    exit(1)
+}
@@ -0,0 +1,147 @@
+//
+//  LRUCache.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// A thread-safe, fixed-capacity least-recently-used cache.
+///
+/// Lookups and insertions are O(1). When the cache is full, inserting a new key evicts
+/// the entry that was read or written the longest time ago.
+///
+/// Example:
+/// ```swift
+/// let cache = LRUCache<String, [Int]>(capacity: 2)
+/// cache.setValue([1], forKey: "a")
+/// cache.setValue([2], forKey: "b")
+/// _ = cache.value(forKey: "a")   // "a" is now the most recent entry
+/// cache.setValue([3], forKey: "c") // evicts "b"
+/// ```
+package final class LRUCache<Key: Hashable, Value>: @unchecked Sendable {
+    private final class Node {
+        let key: Key
+        var value: Value
+        weak var previous: Node?
+        var next: Node?
+
+        init(key: Key, value: Value) {
+            self.key = key
+            self.value = value
+        }
+    }
+
+    private let lock = NSLock()
+    private let capacity: Int
+    private var nodes: [Key: Node] = [:]
+
+    /// Most recently used entry.
+    private var head: Node?
+
+    /// Least recently used entry.
+    private var tail: Node?
+
+    /// Creates a cache holding at most `capacity` entries.
+    package init(capacity: Int) {
+        precondition(capacity > 0, "LRUCache capacity must be greater than zero")
+        self.capacity = capacity
+    }
+
+    /// Number of entries currently stored.
+    package var count: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return nodes.count
+    }
+
+    /// Returns the value stored for `key`, marking it as the most recently used entry.
+    package func value(forKey key: Key) -> Value? {
+        lock.lock()
+        defer { lock.unlock() }
+
+        guard let node = nodes[key] else { return nil }
+        moveToHead(node)
+        return node.value
+    }
+
+    /// Stores `value` for `key`, evicting the least recently used entry when full.
+    package func setValue(_ value: Value, forKey key: Key) {
+        lock.lock()
+        defer { lock.unlock() }
+
+        if let node = nodes[key] {
+            node.value = value
+            moveToHead(node)
+            return
+        }
+
+        let node = Node(key: key, value: value)
+        nodes[key] = node
+        insertAtHead(node)
+
+        if nodes.count > capacity, let tail {
+            unlink(tail)
+            nodes[tail.key] = nil
+        }
+    }
+
+    /// Removes the value stored for `key`, if any.
+    package func removeValue(forKey key: Key) {
+        lock.lock()
+        defer { lock.unlock() }
+
+        guard let node = nodes.removeValue(forKey: key) else { return }
+        unlink(node)
+    }
+
+    /// Removes every entry from the cache.
+    package func removeAll() {
+        lock.lock()
+        defer { lock.unlock() }
+
+        nodes.removeAll()
+        head = nil
+        tail = nil
+    }
+}
+
+// MARK: - Linked List
+
+private extension LRUCache {
+    func insertAtHead(_ node: Node) {
+        node.next = head
+        node.previous = nil
+        head?.previous = node
+        head = node
+
+        if tail == nil {
+            tail = node
+        }
+    }
+
+    func unlink(_ node: Node) {
+        let previous = node.previous
+        let next = node.next
+
+        previous?.next = next
+        next?.previous = previous
+
+        if head === node {
+            head = next
+        }
+        if tail === node {
+            tail = previous
+        }
+
+        node.previous = nil
+        node.next = nil
+    }
+
+    func moveToHead(_ node: Node) {
+        guard head !== node else { return }
+        unlink(node)
+        insertAtHead(node)
+    }
+}
@@ -0,0 +1,68 @@
+//
+//  SiteIDStore.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Persists the site ID resolved for each public key, so later launches can use it
+/// before the API answers.
+///
+/// Entries are kept in a small binary property list. Reads happen once per `initialize`;
+/// writes only when the API returns a different site ID.
+struct SiteIDStore: Sendable {
+    private let fileURL: URL?
+
+    /// Creates a store.
+    /// - Parameter fileURL: File backing the store, or `nil` to persist nothing.
+    init(fileURL: URL?) {
+        self.fileURL = fileURL
+    }
+
+    /// Default store located at `Caches/MPSiteID/site_ids.plist`.
+    static func makeDefault() -> SiteIDStore {
+        let directory = FileManager.default
+            .urls(for: .cachesDirectory, in: .userDomainMask)
+            .first?
+            .appendingPathComponent("MPSiteID", isDirectory: true)
+
+        return SiteIDStore(fileURL: directory?.appendingPathComponent("site_ids.plist"))
+    }
+
+    /// Site ID stored for `publicKey`, if any.
+    func siteID(for publicKey: String) -> String? {
+        self.load()[publicKey]
+    }
+
+    /// Stores `siteID` for `publicKey`, keeping the entries of other keys.
+    func store(_ siteID: String, for publicKey: String) {
+        guard let fileURL else { return }
+
+        var entries = self.load()
+        guard entries[publicKey] != siteID else { return }
+        entries[publicKey] = siteID
+
+        let encoder = PropertyListEncoder()
+        encoder.outputFormat = .binary
+        guard let data = try? encoder.encode(entries) else { return }
+
+        try? FileManager.default.createDirectory(
+            at: fileURL.deletingLastPathComponent(),
+            withIntermediateDirectories: true
+        )
+        try? data.write(to: fileURL, options: .atomic)
+    }
+}
+
+// MARK: - Private Methods
+
+private extension SiteIDStore {
+    func load() -> [String: String] {
+        guard let fileURL, let data = try? Data(contentsOf: fileURL) else {
+            return [:]
+        }
+        return (try? PropertyListDecoder().decode([String: String].self, from: data)) ?? [:]
+    }
+}
@@ -0,0 +1,82 @@
+//
+//  AtomicFlag.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+#if canImport(Synchronization)
+    import Synchronization
+#endif
+
+/// A Boolean read and written from any thread.
+///
+/// Backed by `Atomic` where the OS provides it (iOS 18 and later), so reads never take a lock;
+/// falls back to an `NSLock` on earlier versions.
+package final class AtomicFlag: @unchecked Sendable {
+    private let storage: any FlagStorage
+
+    package init(_ value: Bool) {
+        #if canImport(Synchronization)
+            if #available(iOS 18.0, macOS 15.0, tvOS 18.0, watchOS 11.0, visionOS 2.0, *) {
+                self.storage = AtomicFlagStorage(value)
+                return
+            }
+        #endif
+        self.storage = LockedFlagStorage(value)
+    }
+
+    package var value: Bool {
+        get { storage.load() }
+        set { storage.store(newValue) }
+    }
+}
+
+// MARK: - Storage
+
+private protocol FlagStorage: AnyObject, Sendable {
+    func load() -> Bool
+    func store(_ value: Bool)
+}
+
+#if canImport(Synchronization)
+    @available(iOS 18.0, macOS 15.0, tvOS 18.0, watchOS 11.0, visionOS 2.0, *)
+    private final class AtomicFlagStorage: FlagStorage {
+        private let flag: Atomic<Bool>
+
+        init(_ value: Bool) {
+            self.flag = Atomic(value)
+        }
+
+        func load() -> Bool {
+            flag.load(ordering: .acquiring)
+        }
+
+        func store(_ value: Bool) {
+            flag.store(value, ordering: .releasing)
+        }
+    }
+#endif
+
+private final class LockedFlagStorage: FlagStorage, @unchecked Sendable {
+    private let lock = NSLock()
+    private var flag: Bool
+
+    init(_ value: Bool) {
+        self.flag = value
+    }
+
+    func load() -> Bool {
+        lock.lock()
+        defer { lock.unlock() }
+        return flag
+    }
+
+    func store(_ value: Bool) {
+        lock.lock()
+        defer { lock.unlock() }
+        flag = value
+    }
+}
@@ -14,7 +14,7 @@ package protocol HasNoDependency: Sendable {}
 
 
 /// Protocol combining core SDK dependencies for analytics and networking
-typealias DI = Sendable & HasNoDependency & HasAnalytics & HasNetwork & HasFingerPrint
+typealias DI = Sendable & HasNoDependency & HasAnalytics & HasNetwork & HasFingerPrint & HasSiteIDProvider
 
 /// Main dependency container managing SDK services
 ///
@@ -34,24 +34,40 @@ typealias DI = Sendable & HasNoDependency & HasAnalytics & HasNetwork & HasFinge
 /// }
 /// ```
 package final class CoreDependencyContainer: DI {
-    /// Network service for handling API requests
-    package let networkService: NetworkServiceProtocol
+    /// Network service for handling API requests, built on first use
+    package var networkService: NetworkServiceProtocol {
+        self.lazyNetworkService.value
+    }
 
-    /// Analytics service for tracking SDK events
+    /// Analytics service for tracking SDK events, built on first use
     package var analytics: AnalyticsInterface {
-        return MPAnalytics()
+        self.lazyAnalytics.value
     }
 
-    package let fingerPrint: FingerPrintProtocol
+    /// Device fingerprint collector, built on first use
+    package var fingerPrint: FingerPrintProtocol {
+        self.lazyFingerPrint.value
+    }
+
+    /// Site ID of the configured public key, resolved by the SDK
+    package var siteIDProvider: SiteIDProviderProtocol {
+        MercadoPagoSDK.shared
+    }
 
     /// Shared singleton instance of the container
     package static let shared = CoreDependencyContainer()
 
-    /// Private initializer configuring default services
+    private let lazyNetworkService: LazyDependency<NetworkServiceProtocol>
+    private let lazyAnalytics: LazyDependency<AnalyticsInterface>
+    private let lazyFingerPrint = LazyDependency<FingerPrintProtocol> { FingerPrint() }
+
+    /// Initializer configuring default services. Services are only built on first access,
+    /// so creating the container at app launch does not create sessions, caches or files.
     package init(
-        networkService: NetworkServiceProtocol = NetworkService()
+        networkService: @autoclosure @escaping @Sendable () -> NetworkServiceProtocol = NetworkService(),
+        analytics: @autoclosure @escaping @Sendable () -> AnalyticsInterface = MPAnalytics.shared
     ) {
-        self.networkService = networkService
-        self.fingerPrint = FingerPrint()
+        self.lazyNetworkService = LazyDependency(networkService)
+        self.lazyAnalytics = LazyDependency(analytics)
     }
 }
@@ -0,0 +1,26 @@
+//
+//  HasSiteIDProvider.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+/// Resolves the site ID of the configured public key.
+package protocol SiteIDProviderProtocol: Sendable {
+    /// Site ID of the configured public key, or its best known fallback.
+    var siteID: String { get }
+
+    /// Waits until the site ID of the configured public key is resolved.
+    func prefetchSiteID() async
+
+    /// Starts the SDK subsystems deferred by `MercadoPagoSDK.StartupMode.deferred`, resolving
+    /// the site ID among them. Called by every public entry point of the SDK modules.
+    func startIfNeeded()
+}
+
+/// A protocol that provides access to the site ID of the configured public key.
+package protocol HasSiteIDProvider: Sendable {
+    var siteIDProvider: SiteIDProviderProtocol { get }
+}
+
+extension MercadoPagoSDK: SiteIDProviderProtocol {}
@@ -0,0 +1,44 @@
+//
+//  LazyDependency.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// A dependency built on first access, exactly once, from any thread.
+///
+/// Keeps the construction cost of a service (sessions, caches, file lookups) out of the
+/// container initializer, so building the container at app launch costs almost nothing.
+final class LazyDependency<Value>: @unchecked Sendable {
+    private let lock = NSLock()
+    private var make: (@Sendable () -> Value)?
+    private var storage: Value?
+
+    init(_ make: @escaping @Sendable () -> Value) {
+        self.make = make
+    }
+
+    /// The dependency, built by the first caller.
+    var value: Value {
+        lock.lock()
+        defer { lock.unlock() }
+
+        if let storage {
+            return storage
+        }
+
+        let value = make!()
+        storage = value
+        make = nil
+        return value
+    }
+
+    /// Whether the dependency was built.
+    var isBuilt: Bool {
+        lock.lock()
+        defer { lock.unlock() }
+        return storage != nil
+    }
+}
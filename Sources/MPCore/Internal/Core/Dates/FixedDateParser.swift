@@ -0,0 +1,194 @@
+//
+//  FixedDateParser.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Allocation-free parser for the fixed date formats used by the API and the card fields.
+///
+/// Unlike `DateFormatter`, it does not depend on the locale, calendar or time zone of the
+/// device, and reads the UTF-8 bytes of the input in place.
+///
+/// Example:
+/// ```swift
+/// FixedDateParser.date(iso8601: "2025-03-07T00:00:00.000-0400") // 2025-03-07 04:00:00 UTC
+/// FixedDateParser.expiration("11/30", century: 2000)           // November 2030
+/// ```
+package enum FixedDateParser {
+    /// Parses an ISO-8601 date and time such as `2025-03-07T00:00:00.000-0400`.
+    ///
+    /// The fraction of a second is optional (1 to 9 digits). The offset is `Z`, `±HHmm` or `±HH:mm`.
+    ///
+    /// - Returns: The date, or `nil` when `text` does not match or names an invalid date.
+    package static func date(iso8601 text: String) -> Date? {
+        let contiguous = text.utf8.withContiguousStorageIfAvailable { Self.date(iso8601: $0) }
+        return contiguous ?? Self.date(iso8601: Array(text.utf8))
+    }
+
+    /// Parses an expiration date `MM/YY` or `MM/YYYY`.
+    ///
+    /// - Parameters:
+    ///   - text: Month and year separated by `/`.
+    ///   - century: Added to two-digit years, e.g. `2000`.
+    /// - Returns: The month, or `nil` when `text` does not match or the month is not 1 to 12.
+    package static func expiration(_ text: String, century: Int) -> YearMonth? {
+        let contiguous = text.utf8.withContiguousStorageIfAvailable { Self.expiration($0, century: century) }
+        return contiguous ?? Self.expiration(Array(text.utf8), century: century)
+    }
+}
+
+// MARK: - Parsing
+
+private extension FixedDateParser {
+    static func date<Bytes: RandomAccessCollection>(iso8601 bytes: Bytes) -> Date?
+        where Bytes.Element == UInt8, Bytes.Index == Int {
+        var cursor = Cursor(bytes)
+
+        guard let year = cursor.number(digits: 4), cursor.skip("-"),
+              let month = cursor.number(digits: 2), cursor.skip("-"),
+              let day = cursor.number(digits: 2), cursor.skip("T"),
+              let hour = cursor.number(digits: 2), cursor.skip(":"),
+              let minute = cursor.number(digits: 2), cursor.skip(":"),
+              let second = cursor.number(digits: 2) else {
+            return nil
+        }
+
+        var fraction: Double = 0
+        if cursor.skip(".") {
+            guard let value = cursor.fraction() else { return nil }
+            fraction = value
+        }
+
+        var offset = 0
+        if !cursor.skip("Z") {
+            let sign: Int
+            if cursor.skip("+") {
+                sign = 1
+            } else if cursor.skip("-") {
+                sign = -1
+            } else {
+                return nil
+            }
+
+            guard let offsetHours = cursor.number(digits: 2) else { return nil }
+            _ = cursor.skip(":")
+            guard let offsetMinutes = cursor.number(digits: 2), offsetHours < 24, offsetMinutes < 60 else {
+                return nil
+            }
+            offset = sign * (offsetHours * 3600 + offsetMinutes * 60)
+        }
+
+        guard cursor.isAtEnd,
+              (1 ... 12).contains(month),
+              (1 ... Self.daysIn(month: month, year: year)).contains(day),
+              hour < 24, minute < 60, second < 60 else {
+            return nil
+        }
+
+        let days = Self.daysSince1970(year: year, month: month, day: day)
+        let seconds = days * 86400 + hour * 3600 + minute * 60 + second - offset
+        return Date(timeIntervalSince1970: Double(seconds) + fraction)
+    }
+
+    static func expiration<Bytes: RandomAccessCollection>(_ bytes: Bytes, century: Int) -> YearMonth?
+        where Bytes.Element == UInt8, Bytes.Index == Int {
+        var cursor = Cursor(bytes)
+
+        guard let month = cursor.number(digits: 2), cursor.skip("/"), (1 ... 12).contains(month) else {
+            return nil
+        }
+
+        switch cursor.remaining {
+        case 2:
+            guard let year = cursor.number(digits: 2) else { return nil }
+            return YearMonth(year: century + year, month: month)
+        case 4:
+            guard let year = cursor.number(digits: 4) else { return nil }
+            return YearMonth(year: year, month: month)
+        default:
+            return nil
+        }
+    }
+
+    static func daysIn(month: Int, year: Int) -> Int {
+        switch month {
+        case 2:
+            let isLeap = year % 4 == 0 && (year % 100 != 0 || year % 400 == 0)
+            return isLeap ? 29 : 28
+        case 4, 6, 9, 11:
+            return 30
+        default:
+            return 31
+        }
+    }
+
+    /// Days between 1970-01-01 and a date of the proleptic Gregorian calendar.
+    static func daysSince1970(year: Int, month: Int, day: Int) -> Int {
+        // Counts from March, so the leap day is the last day of the year.
+        let year = month <= 2 ? year - 1 : year
+        let era = (year >= 0 ? year : year - 399) / 400
+        let yearOfEra = year - era * 400
+        let dayOfYear = (153 * ((month + 9) % 12) + 2) / 5 + day - 1
+        let dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear
+        return era * 146_097 + dayOfEra - 719_468
+    }
+}
+
+// MARK: - Cursor
+
+/// Reads fixed-width fields from UTF-8 bytes.
+private struct Cursor<Bytes: RandomAccessCollection> where Bytes.Element == UInt8, Bytes.Index == Int {
+    private let bytes: Bytes
+    private var index: Int
+
+    init(_ bytes: Bytes) {
+        self.bytes = bytes
+        self.index = bytes.startIndex
+    }
+
+    var isAtEnd: Bool {
+        self.index == self.bytes.endIndex
+    }
+
+    var remaining: Int {
+        self.bytes.endIndex - self.index
+    }
+
+    /// Consumes `byte` when it is next.
+    mutating func skip(_ byte: Unicode.Scalar) -> Bool {
+        guard !self.isAtEnd, self.bytes[self.index] == UInt8(ascii: byte) else { return false }
+        self.index += 1
+        return true
+    }
+
+    /// Consumes exactly `digits` ASCII digits.
+    mutating func number(digits: Int) -> Int? {
+        guard self.remaining >= digits else { return nil }
+
+        var value = 0
+        for offset in 0 ..< digits {
+            let byte = self.bytes[self.index + offset]
+            guard byte >= UInt8(ascii: "0"), byte <= UInt8(ascii: "9") else { return nil }
+            value = value * 10 + Int(byte - UInt8(ascii: "0"))
+        }
+        self.index += digits
+        return value
+    }
+
+    /// Consumes 1 to 9 digits following a decimal point.
+    mutating func fraction() -> Double? {
+        var value = 0
+        var scale = 1
+        while !self.isAtEnd, scale < 1_000_000_000 {
+            let byte = self.bytes[self.index]
+            guard byte >= UInt8(ascii: "0"), byte <= UInt8(ascii: "9") else { break }
+            value = value * 10 + Int(byte - UInt8(ascii: "0"))
+            scale *= 10
+            self.index += 1
+        }
+        return scale > 1 ? Double(value) / Double(scale) : nil
+    }
+}
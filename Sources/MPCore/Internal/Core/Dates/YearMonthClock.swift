@@ -0,0 +1,91 @@
+//
+//  YearMonthClock.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// A month of a year, e.g. the expiration month of a card.
+package struct YearMonth: Sendable, Equatable, Comparable {
+    package let year: Int
+
+    /// Month, from 1 to 12.
+    package let month: Int
+
+    package init(year: Int, month: Int) {
+        self.year = year
+        self.month = month
+    }
+
+    /// First year of the century, e.g. `2000` for 2026.
+    package var century: Int {
+        self.year / 100 * 100
+    }
+
+    package static func < (lhs: YearMonth, rhs: YearMonth) -> Bool {
+        (lhs.year, lhs.month) < (rhs.year, rhs.month)
+    }
+}
+
+/// Source of the current month, injected where expiration dates are checked.
+package protocol YearMonthClock: Sendable {
+    var current: YearMonth { get }
+}
+
+package extension YearMonthClock {
+    /// First two digits of the current year, e.g. `"20"` in 2026.
+    var firstTwoDigitsOfYear: String {
+        String(self.current.year / 100)
+    }
+}
+
+/// Current month of the system clock.
+///
+/// The calendar is only consulted when the month changes; in between, `current` costs a
+/// clock read and a comparison, so it can be called on every keystroke.
+package final class SystemYearMonthClock: YearMonthClock, @unchecked Sendable {
+    package static let shared = SystemYearMonthClock()
+
+    private let lock = NSLock()
+    private let calendar: Calendar
+    private let now: @Sendable () -> Date
+
+    private var cached: YearMonth?
+
+    /// Bounds of the cached month, as `timeIntervalSinceReferenceDate`.
+    private var validFrom: TimeInterval = 0
+    private var validUntil: TimeInterval = 0
+
+    /// Creates a clock.
+    ///
+    /// - Parameters:
+    ///   - calendar: Calendar dividing time into months.
+    ///   - now: Current date; injectable for tests.
+    package init(calendar: Calendar = .autoupdatingCurrent, now: @escaping @Sendable () -> Date = { Date() }) {
+        self.calendar = calendar
+        self.now = now
+    }
+
+    package var current: YearMonth {
+        let date = self.now()
+        let time = date.timeIntervalSinceReferenceDate
+
+        lock.lock()
+        defer { lock.unlock() }
+
+        if let cached, time >= validFrom, time < validUntil {
+            return cached
+        }
+
+        let components = calendar.dateComponents([.year, .month], from: date)
+        let current = YearMonth(year: components.year ?? 0, month: components.month ?? 0)
+        let month = calendar.dateInterval(of: .month, for: date)
+
+        cached = current
+        validFrom = month?.start.timeIntervalSinceReferenceDate ?? time
+        validUntil = month?.end.timeIntervalSinceReferenceDate ?? time
+        return current
+    }
+}
@@ -0,0 +1,207 @@
+//
+//  JSONWriter.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Writes JSON straight into a byte buffer, without building `[String: Any]` dictionaries
+/// or bridging through `JSONSerialization`.
+///
+/// Commas are inserted automatically between the members of an object. Already encoded JSON,
+/// such as the device fingerprint, is spliced in verbatim with `raw(_:)`.
+///
+/// Example:
+/// ```swift
+/// var writer = JSONWriter(capacity: 256 + device.count)
+/// writer.beginObject()
+/// writer.field("security_code", "123")
+/// writer.field("require_esc", nil as Bool?)
+/// writer.rawField("device", device)
+/// writer.endObject()
+/// let body = writer.data
+/// ```
+package struct JSONWriter {
+    private var bytes: [UInt8] = []
+
+    /// Whether the next key or value must be preceded by a comma.
+    private var needsComma = false
+
+    /// Creates a writer whose buffer holds `capacity` bytes before growing.
+    package init(capacity: Int = 256) {
+        self.bytes.reserveCapacity(capacity)
+    }
+
+    /// The JSON written so far.
+    package var data: Data {
+        Data(self.bytes)
+    }
+
+    // MARK: - Structure
+
+    package mutating func beginObject() {
+        self.separate()
+        self.bytes.append(UInt8(ascii: "{"))
+        self.needsComma = false
+    }
+
+    package mutating func endObject() {
+        self.bytes.append(UInt8(ascii: "}"))
+        self.needsComma = true
+    }
+
+    package mutating func beginArray() {
+        self.separate()
+        self.bytes.append(UInt8(ascii: "["))
+        self.needsComma = false
+    }
+
+    package mutating func endArray() {
+        self.bytes.append(UInt8(ascii: "]"))
+        self.needsComma = true
+    }
+
+    /// Writes an object key; the next call writes its value.
+    package mutating func key(_ name: StaticString) {
+        self.separate()
+        self.bytes.append(UInt8(ascii: "\""))
+        name.withUTF8Buffer { self.bytes.append(contentsOf: $0) }
+        self.bytes.append(contentsOf: [UInt8(ascii: "\""), UInt8(ascii: ":")])
+        // The value that follows belongs to this key.
+        self.needsComma = false
+    }
+
+    /// Writes an object key known only at runtime, escaping it like a string value.
+    /// Prefer `key(_:)` for the fixed keys of SDK payloads.
+    package mutating func dynamicKey(_ name: String) {
+        self.string(name)
+        self.bytes.append(UInt8(ascii: ":"))
+        self.needsComma = false
+    }
+
+    // MARK: - Values
+
+    package mutating func string(_ value: String) {
+        self.separate()
+        self.bytes.append(UInt8(ascii: "\""))
+        for byte in value.utf8 {
+            self.appendEscaped(byte)
+        }
+        self.bytes.append(UInt8(ascii: "\""))
+        self.needsComma = true
+    }
+
+    /// Writes `value` as an integer when it has no fractional part, the way `JSONSerialization` does.
+    /// Non-finite numbers are written as `null`.
+    package mutating func number(_ value: Double) {
+        guard value.isFinite else { return self.null() }
+
+        self.separate()
+        if value.rounded() == value, abs(value) < 1e15 {
+            self.bytes.append(contentsOf: String(Int64(value)).utf8)
+        } else {
+            self.bytes.append(contentsOf: String(value).utf8)
+        }
+        self.needsComma = true
+    }
+
+    package mutating func bool(_ value: Bool) {
+        self.separate()
+        self.bytes.append(contentsOf: value ? Self.trueBytes : Self.falseBytes)
+        self.needsComma = true
+    }
+
+    package mutating func null() {
+        self.separate()
+        self.bytes.append(contentsOf: Self.nullBytes)
+        self.needsComma = true
+    }
+
+    /// Splices an already encoded JSON value verbatim.
+    package mutating func raw(_ json: Data) {
+        self.separate()
+        self.bytes.append(contentsOf: json)
+        self.needsComma = true
+    }
+
+    // MARK: - Fields
+
+    /// Writes `"name": value`, or `"name": null` when `value` is `nil`.
+    package mutating func field(_ name: StaticString, _ value: String?) {
+        self.key(name)
+        if let value { self.string(value) } else { self.null() }
+    }
+
+    /// Writes `"name": value`, or `"name": null` when `value` is `nil`.
+    package mutating func field(_ name: StaticString, _ value: Double?) {
+        self.key(name)
+        if let value { self.number(value) } else { self.null() }
+    }
+
+    /// Writes `"name": value`, or `"name": null` when `value` is `nil`.
+    package mutating func field(_ name: StaticString, _ value: Bool?) {
+        self.key(name)
+        if let value { self.bool(value) } else { self.null() }
+    }
+
+    /// Writes `"name": json` when `json` holds an encoded JSON object, and nothing otherwise.
+    ///
+    /// Only the enclosing braces are checked, so `json` must already be valid, e.g. the device
+    /// fingerprint returned by `FingerPrint`, which validates each new value once.
+    package mutating func rawField(_ name: StaticString, _ json: Data?) {
+        guard let json, Self.isObject(json) else { return }
+
+        self.key(name)
+        self.raw(json)
+    }
+}
+
+// MARK: - Private Methods
+
+private extension JSONWriter {
+    static let trueBytes = Array("true".utf8)
+    static let falseBytes = Array("false".utf8)
+    static let nullBytes = Array("null".utf8)
+    static let hexDigits = Array("0123456789abcdef".utf8)
+
+    mutating func separate() {
+        if self.needsComma {
+            self.bytes.append(UInt8(ascii: ","))
+        }
+    }
+
+    mutating func appendEscaped(_ byte: UInt8) {
+        switch byte {
+        case UInt8(ascii: "\""):
+            self.bytes.append(contentsOf: [UInt8(ascii: "\\"), UInt8(ascii: "\"")])
+        case UInt8(ascii: "\\"):
+            self.bytes.append(contentsOf: [UInt8(ascii: "\\"), UInt8(ascii: "\\")])
+        case UInt8(ascii: "\n"):
+            self.bytes.append(contentsOf: [UInt8(ascii: "\\"), UInt8(ascii: "n")])
+        case UInt8(ascii: "\r"):
+            self.bytes.append(contentsOf: [UInt8(ascii: "\\"), UInt8(ascii: "r")])
+        case UInt8(ascii: "\t"):
+            self.bytes.append(contentsOf: [UInt8(ascii: "\\"), UInt8(ascii: "t")])
+        case 0x00 ..< 0x20:
+            self.bytes.append(contentsOf: [
+                UInt8(ascii: "\\"), UInt8(ascii: "u"), UInt8(ascii: "0"), UInt8(ascii: "0"),
+                Self.hexDigits[Int(byte >> 4)], Self.hexDigits[Int(byte & 0x0F)]
+            ])
+        default:
+            self.bytes.append(byte)
+        }
+    }
+
+    /// Whether `json`, ignoring surrounding whitespace, starts with `{` and ends with `}`.
+    static func isObject(_ json: Data) -> Bool {
+        let isWhitespace: (UInt8) -> Bool = { $0 == 0x20 || $0 == 0x0A || $0 == 0x0D || $0 == 0x09 }
+
+        guard let first = json.first(where: { !isWhitespace($0) }),
+              let last = json.last(where: { !isWhitespace($0) }) else {
+            return false
+        }
+        return first == UInt8(ascii: "{") && last == UInt8(ascii: "}")
+    }
+}
@@ -0,0 +1,22 @@
+//
+//  Calendar+DateFromExpiration.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 18/02/25.
+//
+import Foundation
+
+package extension Calendar {
+    /// First day of the month of an `MM/YY` expiration, in the century of `clock`.
+    internal func dateFromExpiration(
+        _ value: String?,
+        clock: any YearMonthClock = SystemYearMonthClock.shared
+    ) -> Date? {
+        guard let value, value.utf8.count == 5,
+              let expiration = FixedDateParser.expiration(value, century: clock.current.century) else {
+            return nil
+        }
+
+        return self.date(from: DateComponents(year: expiration.year, month: expiration.month, day: 1))
+    }
+}
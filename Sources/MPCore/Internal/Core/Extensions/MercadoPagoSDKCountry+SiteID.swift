@@ -13,7 +13,7 @@ extension MercadoPagoSDK.Country {
         case .ARG:
             return "MLA"
         case .COL:
-            return "MLC"
+            return "MCO"
         case .MEX:
             return "MLM"
         case .CHL:
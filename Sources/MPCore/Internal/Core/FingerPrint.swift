@@ -16,11 +16,53 @@ package protocol FingerPrintProtocol: Sendable {
     func getDeviceData() async -> Data?
 }
 
-package final class FingerPrint: FingerPrintProtocol {
-    package init() {}
+package final class FingerPrint: FingerPrintProtocol, @unchecked Sendable {
+    private let validate: @Sendable (Data?) -> Data?
+    private let lock = NSLock()
+
+    /// Last fingerprint that passed validation.
+    private var lastValidated: Data?
+
+    /// - Parameter validate: Check of a collected fingerprint, `validated(_:)` by default.
+    package init(validate: @escaping @Sendable (Data?) -> Data? = FingerPrint.validated) {
+        self.validate = validate
+    }
 
     @MainActor
     package func getDeviceData() async -> Data? {
-        return Device.getInfoAsJsonData()
+        return self.validatedOnce(Device.getInfoAsJsonData())
+    }
+
+    /// Validates `data` unless it equals the last fingerprint that passed validation.
+    ///
+    /// The fingerprint seldom changes between tokenizations, so a byte comparison usually
+    /// replaces the parse.
+    func validatedOnce(_ data: Data?) -> Data? {
+        guard let data else { return nil }
+
+        lock.lock()
+        let lastValidated = self.lastValidated
+        lock.unlock()
+
+        if data == lastValidated {
+            return lastValidated
+        }
+        guard let validated = self.validate(data) else { return nil }
+
+        lock.lock()
+        self.lastValidated = validated
+        lock.unlock()
+        return validated
+    }
+
+    /// Returns `data` when it holds a JSON object, and `nil` otherwise.
+    ///
+    /// The fingerprint is produced by the binary `DeviceFingerPrint` framework and is embedded
+    /// verbatim in the tokenization bodies, so it is parsed here rather than trusted.
+    package static func validated(_ data: Data?) -> Data? {
+        guard let data, (try? JSONSerialization.jsonObject(with: data)) is [String: Any] else {
+            return nil
+        }
+        return data
     }
 }
@@ -0,0 +1,158 @@
+//
+//  TraceEncoder.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Encodes spans as Chrome `trace_event` JSON or OTLP-JSON.
+enum TraceEncoder {
+    /// Chrome trace: operations are complete (`X`) events and instants are global instant (`i`)
+    /// events. Each top-level operation gets its own row (`tid`) so concurrent operations do not
+    /// overlap; their children nest under them.
+    static func chromeTrace(_ spans: [MPTracer.Span]) -> Data {
+        var writer = JSONWriter(capacity: 64 + spans.count * 192)
+        var rows: [String: Int] = [:]
+
+        writer.beginObject()
+        writer.key("traceEvents")
+        writer.beginArray()
+        for span in spans {
+            let row: Int
+            if let existing = rows[span.rootSpanID] {
+                row = existing
+            } else {
+                row = rows.count + 1
+                rows[span.rootSpanID] = row
+            }
+
+            writer.beginObject()
+            writer.field("name", span.name)
+            writer.field("cat", "mpsdk")
+            writer.field("ph", span.isInstant ? "i" : "X")
+            writer.field("ts", Self.microseconds(since1970: span.start))
+            if span.isInstant {
+                writer.field("s", "g")
+            } else {
+                writer.field("dur", (span.duration * 1_000_000).rounded())
+            }
+            writer.field("pid", 1 as Double)
+            writer.field("tid", Double(row))
+            writer.key("args")
+            writer.beginObject()
+            writer.field("trace_id", span.traceID)
+            writer.field("span_id", span.spanID)
+            if let parentSpanID = span.parentSpanID {
+                writer.field("parent_span_id", parentSpanID)
+            }
+            if span.isError {
+                writer.field("error", true)
+            }
+            for (key, value) in span.attributes.sorted(by: { $0.key < $1.key }) {
+                writer.dynamicKey(key)
+                writer.string(value)
+            }
+            writer.endObject()
+            writer.endObject()
+        }
+        writer.endArray()
+        writer.field("displayTimeUnit", "ms")
+        writer.endObject()
+
+        return writer.data
+    }
+
+    /// OTLP-JSON `ExportTraceServiceRequest` with one resource and one scope. Instants are
+    /// exported as zero-length spans.
+    static func otlpJSON(_ spans: [MPTracer.Span]) -> Data {
+        var writer = JSONWriter(capacity: 256 + spans.count * 320)
+
+        writer.beginObject()
+        writer.key("resourceSpans")
+        writer.beginArray()
+        writer.beginObject()
+
+        writer.key("resource")
+        writer.beginObject()
+        writer.key("attributes")
+        writer.beginArray()
+        Self.attribute("service.name", "MercadoPagoSDK", into: &writer)
+        Self.attribute("service.version", MPSDKVersion.version, into: &writer)
+        writer.endArray()
+        writer.endObject()
+
+        writer.key("scopeSpans")
+        writer.beginArray()
+        writer.beginObject()
+        writer.key("scope")
+        writer.beginObject()
+        writer.field("name", "MPCore")
+        writer.field("version", MPSDKVersion.version)
+        writer.endObject()
+
+        writer.key("spans")
+        writer.beginArray()
+        for span in spans {
+            let startNanoseconds = Self.nanoseconds(since1970: span.start)
+            let endNanoseconds = startNanoseconds + UInt64((span.duration * 1_000_000_000).rounded())
+
+            writer.beginObject()
+            writer.field("traceId", span.traceID)
+            writer.field("spanId", span.spanID)
+            if let parentSpanID = span.parentSpanID {
+                writer.field("parentSpanId", parentSpanID)
+            }
+            writer.field("name", span.name)
+            // SPAN_KIND_INTERNAL
+            writer.field("kind", 1 as Double)
+            // 64-bit integers are strings in OTLP-JSON.
+            writer.field("startTimeUnixNano", String(startNanoseconds))
+            writer.field("endTimeUnixNano", String(endNanoseconds))
+            writer.key("attributes")
+            writer.beginArray()
+            for (key, value) in span.attributes.sorted(by: { $0.key < $1.key }) {
+                Self.attribute(key, value, into: &writer)
+            }
+            writer.endArray()
+            writer.key("status")
+            writer.beginObject()
+            // STATUS_CODE_OK / STATUS_CODE_ERROR
+            writer.field("code", span.isError ? 2 : 1 as Double)
+            writer.endObject()
+            writer.endObject()
+        }
+        writer.endArray()
+
+        writer.endObject()
+        writer.endArray()
+        writer.endObject()
+        writer.endArray()
+        writer.endObject()
+
+        return writer.data
+    }
+}
+
+// MARK: - Private Methods
+
+private extension TraceEncoder {
+    static func attribute(_ key: String, _ value: String, into writer: inout JSONWriter) {
+        writer.beginObject()
+        writer.field("key", key)
+        writer.key("value")
+        writer.beginObject()
+        writer.field("stringValue", value)
+        writer.endObject()
+        writer.endObject()
+    }
+
+    static func microseconds(since1970 date: Date) -> Double {
+        (date.timeIntervalSince1970 * 1_000_000).rounded()
+    }
+
+    static func nanoseconds(since1970 date: Date) -> UInt64 {
+        UInt64(max(date.timeIntervalSince1970, 0) * 1_000_000_000)
+    }
+}
@@ -0,0 +1,180 @@
+//
+//  CircuitBreaker.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Fails requests fast while their endpoint keeps failing.
+///
+/// Each endpoint has its own circuit:
+/// - `closed`: attempts are sent and their outcomes fill a window of the latest
+///   `CircuitBreakerPolicy.windowSize` attempts. When the failure rate reaches the threshold,
+///   the circuit opens.
+/// - `open`: attempts throw `APIClientError.circuitOpen` for `openDuration`.
+/// - `halfOpen`: `probes` attempts are let through. The circuit closes once they all
+///   succeed and opens again on the first failure.
+///
+/// Outcomes only count for the state their attempt was admitted under: a slow attempt admitted
+/// while closed that answers once the circuit is half-open is not a probe.
+package final class CircuitBreaker: @unchecked Sendable {
+    /// Outcome of an admitted attempt.
+    package enum Outcome: Sendable {
+        /// The server answered.
+        case success
+        /// The attempt failed with a transient failure.
+        case failure
+        /// The attempt tells nothing about the endpoint, e.g. it was cancelled.
+        case ignored
+    }
+
+    /// Attempt admitted by `admit(_:policy:)`, to pass back with its outcome.
+    package struct Admission: Sendable, Equatable {
+        let endpoint: String
+
+        /// Number of state transitions of the circuit when the attempt was admitted.
+        let generation: Int
+    }
+
+    /// Outcomes of the latest attempts of a closed circuit.
+    struct OutcomeWindow {
+        private var failures: [Bool] = []
+        private var next = 0
+
+        var count: Int {
+            failures.count
+        }
+
+        var failureRate: Double {
+            guard !failures.isEmpty else { return 0 }
+            return Double(failures.lazy.filter { $0 }.count) / Double(failures.count)
+        }
+
+        mutating func record(failure: Bool, capacity: Int) {
+            if failures.count < capacity {
+                failures.append(failure)
+            } else {
+                failures[next % failures.count] = failure
+            }
+            next = (next + 1) % capacity
+        }
+    }
+
+    private struct Circuit {
+        var window = OutcomeWindow()
+        var openedAt: TimeInterval = 0
+        var probesInFlight = 0
+        var probesSucceeded = 0
+        var generation = 0
+        var metrics: MercadoPagoSDK.CircuitMetrics
+
+        mutating func transition(to state: MercadoPagoSDK.CircuitState, at now: TimeInterval) {
+            metrics.state = state
+            generation += 1
+            probesInFlight = 0
+            probesSucceeded = 0
+
+            switch state {
+            case .open:
+                openedAt = now
+                metrics.opened += 1
+            case .halfOpen:
+                metrics.halfOpened += 1
+            case .closed:
+                window = OutcomeWindow()
+                metrics.closed += 1
+            }
+        }
+    }
+
+    private let lock = NSLock()
+    private let now: @Sendable () -> TimeInterval
+    private var circuits: [String: Circuit] = [:]
+
+    /// Creates a breaker.
+    ///
+    /// - Parameter now: Clock of the breaker, in seconds.
+    package init(now: @escaping @Sendable () -> TimeInterval = { ProcessInfo.processInfo.systemUptime }) {
+        self.now = now
+    }
+
+    /// State and transitions of every circuit, sorted by endpoint.
+    package func snapshot() -> [MercadoPagoSDK.CircuitMetrics] {
+        lock.lock()
+        defer { lock.unlock() }
+        return circuits.values.map(\.metrics).sorted { $0.endpoint < $1.endpoint }
+    }
+
+    /// Current state of the circuit of `endpoint`.
+    package func state(of endpoint: String) -> MercadoPagoSDK.CircuitState {
+        lock.lock()
+        defer { lock.unlock() }
+        return circuits[endpoint]?.metrics.state ?? .closed
+    }
+
+    /// Admits an attempt on `endpoint`, moving an open circuit to half-open once `openDuration` elapsed.
+    ///
+    /// - Returns: The admission to record the outcome of the attempt with.
+    /// - Throws: `APIClientError.circuitOpen` with the time left before the next probe, `0` while
+    ///   the probes of a half-open circuit are in flight.
+    package func admit(_ endpoint: String, policy: CircuitBreakerPolicy) throws -> Admission {
+        lock.lock()
+        defer { lock.unlock() }
+
+        let now = self.now()
+        var circuit = circuits[endpoint] ?? Circuit(metrics: MercadoPagoSDK.CircuitMetrics(endpoint: endpoint))
+        defer { circuits[endpoint] = circuit }
+
+        if circuit.metrics.state == .open {
+            let remaining = circuit.openedAt + policy.openDuration - now
+            guard remaining <= 0 else {
+                circuit.metrics.rejected += 1
+                throw APIClientError.circuitOpen(retryAfter: remaining)
+            }
+            circuit.transition(to: .halfOpen, at: now)
+        }
+
+        if circuit.metrics.state == .halfOpen {
+            guard circuit.probesInFlight + circuit.probesSucceeded < policy.probes else {
+                circuit.metrics.rejected += 1
+                throw APIClientError.circuitOpen(retryAfter: 0)
+            }
+            circuit.probesInFlight += 1
+        }
+        return Admission(endpoint: endpoint, generation: circuit.generation)
+    }
+
+    /// Records the outcome of an admitted attempt. Ignored once the circuit changed state since
+    /// the admission.
+    package func record(_ outcome: Outcome, for admission: Admission, policy: CircuitBreakerPolicy) {
+        lock.lock()
+        defer { lock.unlock() }
+
+        guard var circuit = circuits[admission.endpoint], circuit.generation == admission.generation else { return }
+        defer { circuits[admission.endpoint] = circuit }
+
+        switch (circuit.metrics.state, outcome) {
+        case (_, .ignored):
+            circuit.probesInFlight = max(circuit.probesInFlight - 1, 0)
+        case (.halfOpen, .failure):
+            circuit.transition(to: .open, at: self.now())
+        case (.halfOpen, .success):
+            circuit.probesInFlight = max(circuit.probesInFlight - 1, 0)
+            circuit.probesSucceeded += 1
+            if circuit.probesSucceeded >= policy.probes {
+                circuit.transition(to: .closed, at: self.now())
+            }
+        case (.closed, _):
+            circuit.window.record(failure: outcome == .failure, capacity: policy.windowSize)
+            if circuit.window.count >= policy.minimumRequests,
+               circuit.window.failureRate >= policy.failureRateThreshold {
+                circuit.transition(to: .open, at: self.now())
+            }
+        case (.open, _):
+            // Opening starts a new generation, so no attempt is admitted under it.
+            break
+        }
+    }
+}
@@ -9,6 +9,9 @@ import Foundation
 
 package enum Constants {
     static let baseURL = "https://api.mercadopago.com/cho-off"
+
+    /// Host serving every SDK endpoint (`CoreAPIEndpoint`, `CoreMethodsEndpoint` and `ApplePayEndpoint`).
+    static let apiHost = "https://api.mercadopago.com"
 }
 
 /// Endpoints
@@ -77,7 +80,24 @@ extension CoreAPIEndpoint: RequestEndpoint {
     var cachePolicy: NSURLRequest.CachePolicy {
         switch self {
         case .getSiteID:
-            return .returnCacheDataElseLoad
+            // Honors the server cache headers, so a persisted site ID is revalidated
+            // instead of being served from `URLCache` forever.
+            return .useProtocolCachePolicy
+        }
+    }
+
+    var retryPolicy: RetryPolicy {
+        switch self {
+        case .getSiteID:
+            return .default
+        }
+    }
+
+    /// Scheduler lane. The site ID is resolved at startup, ahead of any user action.
+    var priority: RequestPriority {
+        switch self {
+        case .getSiteID:
+            return .background
         }
     }
 
@@ -12,6 +12,10 @@ import Foundation
 /// - `urlRequestIsEmpty`: The URLRequest could not be created.
 /// - `statusCode(Int)`: The status code from the server response is provided.
 /// - `networkError(any Error)`: A network error occurred, with the underlying error provided.
+/// - `circuitOpen(retryAfter:)`: The request was not sent because its endpoint keeps failing; it is
+///   tried again after `retryAfter` seconds.
+/// - `rateLimited(retryAfter:)`: The request was not sent because its endpoint is throttled, e.g. after
+///   a `429` answer; it can be sent after `retryAfter` seconds.
 public enum APIClientError: Error {
     case invalidURL
     case invalidResponse(_ data: Data)
@@ -22,4 +26,18 @@ public enum APIClientError: Error {
     case statusCode(Int)
     case networkError(any Error)
     case apiError(APIErrorResponse)
+    case circuitOpen(retryAfter: TimeInterval)
+    case rateLimited(retryAfter: TimeInterval)
+}
+
+package extension APIClientError {
+    /// Whether the request failed fast without reaching the network.
+    var isShortCircuited: Bool {
+        switch self {
+        case .circuitOpen, .rateLimited:
+            return true
+        default:
+            return false
+        }
+    }
 }
@@ -0,0 +1,47 @@
+//
+//  CircuitBreakerPolicy.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Describes when `NetworkService` stops sending requests to a failing endpoint.
+///
+/// Endpoints opt in through `RequestEndpoint.circuitBreakerPolicy`; the default is `nil`.
+/// Failures are the transient ones retried by `RetryPolicy` (timeouts, lost connections, `408`,
+/// `429` and `5xx`); client errors count as successes since the server answered.
+package struct CircuitBreakerPolicy: Sendable, Equatable {
+    /// Number of latest attempts the failure rate is computed on.
+    package var windowSize: Int
+
+    /// Number of attempts in the window before the failure rate is trusted.
+    package var minimumRequests: Int
+
+    /// Failure rate, in `0 ... 1`, opening the circuit.
+    package var failureRateThreshold: Double
+
+    /// Time requests fail fast before probes are let through.
+    package var openDuration: TimeInterval
+
+    /// Probes sent while half-open; all of them must succeed to close the circuit.
+    package var probes: Int
+
+    /// Opens after half of the latest 10 attempts failed, probing again after 30 s.
+    package static let `default` = CircuitBreakerPolicy()
+
+    package init(
+        windowSize: Int = 10,
+        minimumRequests: Int = 5,
+        failureRateThreshold: Double = 0.5,
+        openDuration: TimeInterval = 30,
+        probes: Int = 1
+    ) {
+        self.windowSize = max(windowSize, 1)
+        self.minimumRequests = min(max(minimumRequests, 1), self.windowSize)
+        self.failureRateThreshold = min(max(failureRateThreshold, 0), 1)
+        self.openDuration = openDuration
+        self.probes = max(probes, 1)
+    }
+}
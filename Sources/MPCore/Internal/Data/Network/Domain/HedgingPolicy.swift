@@ -0,0 +1,54 @@
+//
+//  HedgingPolicy.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Describes when `NetworkService` sends a second, identical copy of a slow `GET` request.
+///
+/// Endpoints in the typing path opt in through `RequestEndpoint.hedgingPolicy`. When the first
+/// request has not answered after the `percentile` latency recently observed for the same path,
+/// a hedge is sent; the first response wins and the other request is cancelled.
+/// Hedges are capped by the hedge budget of `NetworkService`.
+package struct HedgingPolicy: Sendable, Equatable {
+    /// Latency percentile, in `0 ... 1`, after which the hedge is sent.
+    package var percentile: Double
+
+    /// Lower bound of the hedging delay, so fast paths never double their traffic.
+    package var minimumDelay: TimeInterval
+
+    /// Upper bound of the hedging delay.
+    package var maximumDelay: TimeInterval
+
+    /// Delay used until `minimumSamples` latencies were observed for the path.
+    package var fallbackDelay: TimeInterval
+
+    /// Number of latencies needed before the percentile is trusted.
+    package var minimumSamples: Int
+
+    /// Hedges after the p95 latency, between 50 ms and 1 s.
+    package static let `default` = HedgingPolicy()
+
+    package init(
+        percentile: Double = 0.95,
+        minimumDelay: TimeInterval = 0.05,
+        maximumDelay: TimeInterval = 1,
+        fallbackDelay: TimeInterval = 0.5,
+        minimumSamples: Int = 20
+    ) {
+        self.percentile = min(max(percentile, 0), 1)
+        self.minimumDelay = minimumDelay
+        self.maximumDelay = maximumDelay
+        self.fallbackDelay = fallbackDelay
+        self.minimumSamples = minimumSamples
+    }
+
+    /// Delay before hedging, given the `percentile` latency observed for the path, if any.
+    package func delay(observed latency: TimeInterval?) -> TimeInterval {
+        let delay = latency ?? self.fallbackDelay
+        return min(max(delay, self.minimumDelay), self.maximumDelay)
+    }
+}
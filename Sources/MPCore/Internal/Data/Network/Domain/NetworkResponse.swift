@@ -0,0 +1,31 @@
+//
+//  NetworkResponse.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Raw result of a request, used by callers that manage their own decoding or caching.
+package struct NetworkResponse: Sendable {
+    /// Response body. Empty when the server answered `304 Not Modified`.
+    package let data: Data
+
+    /// HTTP status code.
+    package let statusCode: Int
+
+    /// Value of the `ETag` header, if present.
+    package let etag: String?
+
+    /// Indicates the server confirmed the cached representation is still valid.
+    package var isNotModified: Bool {
+        statusCode == 304
+    }
+
+    package init(data: Data, statusCode: Int, etag: String?) {
+        self.data = data
+        self.statusCode = statusCode
+        self.etag = etag
+    }
+}
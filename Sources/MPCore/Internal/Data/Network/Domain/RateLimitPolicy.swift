@@ -0,0 +1,33 @@
+//
+//  RateLimitPolicy.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Describes the client-side token bucket of an endpoint.
+///
+/// Endpoints opt in through `RequestEndpoint.rateLimitPolicy`; the default is `nil`.
+/// Every attempt takes a token; tokens refill at `refillRate` per second up to `capacity`.
+/// A `429` answer blocks the endpoint for its `Retry-After`, or `defaultBackoff` without one.
+package struct RateLimitPolicy: Sendable, Equatable {
+    /// Maximum number of attempts sent in a burst.
+    package var capacity: Double
+
+    /// Tokens regained per second.
+    package var refillRate: Double
+
+    /// Time the endpoint is blocked after a `429` answer without `Retry-After`.
+    package var defaultBackoff: TimeInterval
+
+    /// Bursts of 10 attempts, then 5 per second.
+    package static let `default` = RateLimitPolicy()
+
+    package init(capacity: Double = 10, refillRate: Double = 5, defaultBackoff: TimeInterval = 1) {
+        self.capacity = max(capacity, 1)
+        self.refillRate = max(refillRate, 0.001)
+        self.defaultBackoff = defaultBackoff
+    }
+}
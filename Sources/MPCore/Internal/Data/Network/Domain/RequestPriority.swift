@@ -0,0 +1,24 @@
+//
+//  RequestPriority.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Lane a request is scheduled on by the SDK network scheduler.
+///
+/// - `critical`: card tokenization, the request the user is waiting on after tapping Pay.
+/// - `interactive`: lookups in the typing path (BIN, installments, issuers).
+/// - `background`: prefetch, connection warm-up and analytics uploads. Deferred while a
+///   critical request is in flight.
+public enum RequestPriority: String, Sendable, CaseIterable {
+    case critical
+    case interactive
+    case background
+
+    /// Lane forced on every request started from the current task, e.g. `.background`
+    /// while prefetching. Overrides `RequestEndpoint.priority`.
+    @TaskLocal package static var override: RequestPriority?
+}
@@ -0,0 +1,142 @@
+//
+//  RetryPolicy.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Describes how `NetworkService` retries a failed request.
+///
+/// Endpoints opt in through `RequestEndpoint.retryPolicy`; the default is `.none`.
+/// Retries wait with exponential backoff and full jitter, honour `Retry-After` on `429`/`503`
+/// answers and only happen for transient failures:
+/// - `APIClientError.networkError` caused by a transient `URLError` (timeouts, lost connections, DNS),
+/// - `408`, `429` and `5xx` status codes other than `501`.
+///
+/// Requests that are not idempotent (anything but `GET`) are only retried when they carry
+/// an idempotency key, see `attachesIdempotencyKey`.
+///
+/// Example:
+/// ```swift
+/// var retryPolicy: RetryPolicy {
+///     .default.idempotent()
+/// }
+/// ```
+package struct RetryPolicy: Sendable, Equatable {
+    /// Header carrying the idempotency key of a request.
+    package static let idempotencyKeyHeader = "X-Idempotency-Key"
+
+    /// Total number of attempts, including the first one.
+    package var maximumAttempts: Int
+
+    /// Upper bound of the delay before the first retry.
+    package var initialDelay: TimeInterval
+
+    /// Upper bound of any delay, including `Retry-After` hints.
+    /// A `Retry-After` longer than this fails the request instead of waiting.
+    package var maximumDelay: TimeInterval
+
+    /// Growth factor of the delay bound between consecutive retries.
+    package var multiplier: Double
+
+    /// Whether `NetworkService` adds an `X-Idempotency-Key` header, shared by all attempts of a call,
+    /// so the server can deduplicate a request retried after a timeout.
+    package var attachesIdempotencyKey: Bool
+
+    /// Never retries.
+    package static let none = RetryPolicy(maximumAttempts: 1)
+
+    /// Three attempts, starting at up to 300 ms between them.
+    package static let `default` = RetryPolicy()
+
+    package init(
+        maximumAttempts: Int = 3,
+        initialDelay: TimeInterval = 0.3,
+        maximumDelay: TimeInterval = 5,
+        multiplier: Double = 2,
+        attachesIdempotencyKey: Bool = false
+    ) {
+        self.maximumAttempts = max(maximumAttempts, 1)
+        self.initialDelay = initialDelay
+        self.maximumDelay = maximumDelay
+        self.multiplier = multiplier
+        self.attachesIdempotencyKey = attachesIdempotencyKey
+    }
+
+    /// Returns a copy of the policy that attaches an idempotency key to each call.
+    package func idempotent() -> RetryPolicy {
+        var policy = self
+        policy.attachesIdempotencyKey = true
+        return policy
+    }
+
+    /// Delay before retry number `retry` (starting at 1).
+    ///
+    /// - Parameters:
+    ///   - retry: Number of the retry about to happen.
+    ///   - retryAfter: Delay requested by the server, used as is when present.
+    ///   - jitter: Random value in `0 ... 1` scaling the backoff bound ("full jitter").
+    /// - Returns: The delay, or `nil` when the server asks to wait longer than `maximumDelay`.
+    package func delay(
+        forRetry retry: Int,
+        retryAfter: TimeInterval? = nil,
+        jitter: Double = .random(in: 0 ... 1)
+    ) -> TimeInterval? {
+        if let retryAfter {
+            return retryAfter <= self.maximumDelay ? max(retryAfter, 0) : nil
+        }
+
+        let bound = self.initialDelay * pow(self.multiplier, Double(max(retry - 1, 0)))
+        return min(bound, self.maximumDelay) * min(max(jitter, 0), 1)
+    }
+}
+
+// MARK: - Classification
+
+package extension RetryPolicy {
+    /// Whether a request answered with `statusCode` may succeed when sent again.
+    static func isRetryable(statusCode: Int) -> Bool {
+        switch statusCode {
+        case 408, 429:
+            return true
+        case 501:
+            return false
+        case 500 ... 599:
+            return true
+        default:
+            return false
+        }
+    }
+
+    /// Whether a request that failed with `error` may succeed when sent again.
+    static func isRetryable(_ error: APIClientError) -> Bool {
+        switch error {
+        case let .networkError(underlying as URLError):
+            return self.retryableURLErrorCodes.contains(underlying.code)
+        case let .statusCode(code), let .notExpectedHttpResponseCode(code):
+            return self.isRetryable(statusCode: code)
+        default:
+            return false
+        }
+    }
+
+    /// Parses a `Retry-After` header given in seconds.
+    ///
+    /// HTTP-date values are ignored and fall back to the backoff delay.
+    static func retryAfter(from response: HTTPURLResponse) -> TimeInterval? {
+        guard let value = response.value(forHTTPHeaderField: "Retry-After") else { return nil }
+        return TimeInterval(value.trimmingCharacters(in: .whitespaces))
+    }
+
+    private static let retryableURLErrorCodes: Set<URLError.Code> = [
+        .timedOut,
+        .networkConnectionLost,
+        .notConnectedToInternet,
+        .cannotConnectToHost,
+        .cannotFindHost,
+        .dnsLookupFailed,
+        .secureConnectionFailed
+    ]
+}
@@ -0,0 +1,113 @@
+//
+//  HedgingController.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Learns recent latencies per path and decides when hedged requests are sent.
+package final class HedgingController: @unchecked Sendable {
+    /// Counters of hedged requests.
+    package struct Statistics: Equatable, Sendable {
+        /// Hedges sent.
+        package var hedged = 0
+
+        /// Hedges that answered before the original request.
+        package var won = 0
+
+        package init(hedged: Int = 0, won: Int = 0) {
+            self.hedged = hedged
+            self.won = won
+        }
+    }
+
+    /// Fixed-size window of the latest latencies of a path.
+    struct LatencyWindow {
+        static let capacity = 64
+
+        private var samples: [TimeInterval] = []
+        private var next = 0
+
+        var count: Int {
+            samples.count
+        }
+
+        mutating func record(_ latency: TimeInterval) {
+            if samples.count < Self.capacity {
+                samples.append(latency)
+            } else {
+                samples[next] = latency
+            }
+            next = (next + 1) % Self.capacity
+        }
+
+        func percentile(_ percentile: Double) -> TimeInterval? {
+            guard !samples.isEmpty else { return nil }
+
+            let sorted = samples.sorted()
+            let rank = Int((percentile * Double(sorted.count - 1)).rounded(.up))
+            return sorted[min(rank, sorted.count - 1)]
+        }
+    }
+
+    private let lock = NSLock()
+    private let budget: RetryBudget
+    private var windows: [String: LatencyWindow] = [:]
+    private var counters = Statistics()
+
+    /// Creates a controller.
+    ///
+    /// - Parameter budget: Hedges left. A hedge spends a token and each answered request refills
+    ///   part of one; the default allows about one hedge every ten requests.
+    package init(budget: RetryBudget = RetryBudget(capacity: 5, depositPerSuccess: 0.1)) {
+        self.budget = budget
+    }
+
+    package var statistics: Statistics {
+        lock.lock()
+        defer { lock.unlock() }
+        return counters
+    }
+
+    /// Delay after which a request on `path` is hedged.
+    func delay(for path: String, policy: HedgingPolicy) -> TimeInterval {
+        lock.lock()
+        let window = windows[path]
+        lock.unlock()
+
+        guard let window, window.count >= policy.minimumSamples else {
+            return policy.delay(observed: nil)
+        }
+        return policy.delay(observed: window.percentile(policy.percentile))
+    }
+
+    /// Records the latency of an answered request on `path`.
+    func record(_ latency: TimeInterval, for path: String) {
+        lock.lock()
+        windows[path, default: LatencyWindow()].record(latency)
+        lock.unlock()
+
+        budget.deposit()
+    }
+
+    /// Takes a hedge from the budget.
+    ///
+    /// - Returns: `false` when the budget is spent and no hedge must be sent.
+    func beginHedge() -> Bool {
+        guard budget.withdraw() else { return false }
+
+        lock.lock()
+        counters.hedged += 1
+        lock.unlock()
+        return true
+    }
+
+    /// Records that a hedge answered first.
+    func recordHedgeWon() {
+        lock.lock()
+        counters.won += 1
+        lock.unlock()
+    }
+}
@@ -0,0 +1,193 @@
+//
+//  NetworkMetricsRecorder.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Aggregates the timing of completed requests into per-endpoint histograms.
+package final class NetworkMetricsRecorder: @unchecked Sendable {
+    private let lock = NSLock()
+    private var endpoints: [String: MercadoPagoSDK.EndpointMetrics] = [:]
+    private var handler: (@Sendable (MercadoPagoSDK.RequestMetrics) -> Void)?
+
+    package init() {}
+
+    /// Histograms of every endpoint, sorted by endpoint.
+    package func snapshot() -> [MercadoPagoSDK.EndpointMetrics] {
+        lock.lock()
+        defer { lock.unlock() }
+        return endpoints.values.sorted { $0.endpoint < $1.endpoint }
+    }
+
+    package func setHandler(_ handler: (@Sendable (MercadoPagoSDK.RequestMetrics) -> Void)?) {
+        lock.lock()
+        defer { lock.unlock() }
+        self.handler = handler
+    }
+
+    /// Adds a completed request to the histograms and forwards it to the handler.
+    package func record(_ metrics: MercadoPagoSDK.RequestMetrics) {
+        lock.lock()
+        var entry = endpoints[metrics.endpoint] ?? MercadoPagoSDK.EndpointMetrics(endpoint: metrics.endpoint)
+        entry.requests += 1
+        if metrics.attempts > 1 {
+            entry.retried += 1
+        }
+        for phase in MercadoPagoSDK.RequestTiming.Phase.allCases {
+            if let duration = metrics.timing.duration(of: phase) {
+                entry.phases[phase, default: MercadoPagoSDK.LatencyHistogram()].record(duration)
+            }
+        }
+        endpoints[metrics.endpoint] = entry
+        let handler = self.handler
+        lock.unlock()
+
+        handler?(metrics)
+    }
+
+    /// Adds a decoding duration measured outside `NetworkService`, e.g. by a repository
+    /// decoding a raw `NetworkResponse`.
+    package func recordDecode(_ duration: TimeInterval, endpoint: String) {
+        lock.lock()
+        defer { lock.unlock() }
+
+        var entry = endpoints[endpoint] ?? MercadoPagoSDK.EndpointMetrics(endpoint: endpoint)
+        entry.phases[.decode, default: MercadoPagoSDK.LatencyHistogram()].record(duration)
+        endpoints[endpoint] = entry
+    }
+}
+
+// MARK: - Collection
+
+/// Timing of one `NetworkService` call, filled by its attempts.
+final class CallMetrics: @unchecked Sendable {
+    /// Scheduler lane every attempt of the call runs on.
+    let priority: RequestPriority
+
+    private let lock = NSLock()
+    private let start = ProcessInfo.processInfo.systemUptime
+    private var attempts = 0
+    private var statusCode: Int?
+    private var decode: TimeInterval?
+    private var transport: TaskMetricsCollector?
+
+    init(priority: RequestPriority = .interactive) {
+        self.priority = priority
+    }
+
+    func beginAttempt() {
+        lock.lock()
+        defer { lock.unlock() }
+        attempts += 1
+    }
+
+    /// Records the answer of the attempt whose result the call returns, with the collector
+    /// receiving its transport timing; `nil` when the session does not report task metrics.
+    func recordAnswer(statusCode: Int, transport: TaskMetricsCollector?) {
+        lock.lock()
+        defer { lock.unlock() }
+        self.statusCode = statusCode
+        self.transport = transport
+    }
+
+    func recordDecode(_ duration: TimeInterval) {
+        lock.lock()
+        defer { lock.unlock() }
+        decode = duration
+    }
+
+    /// Ends the total duration now and passes the metrics of the call to `completion` once the
+    /// transport timing of the answered attempt is known.
+    ///
+    /// The session may report that timing after the response was returned; `completion` then
+    /// runs later, from the session delegate queue, so the caller never waits for it.
+    func finish(endpoint: String, completion: @escaping @Sendable (MercadoPagoSDK.RequestMetrics) -> Void) {
+        lock.lock()
+        let decode = self.decode
+        let total = ProcessInfo.processInfo.systemUptime - start
+        let statusCode = self.statusCode
+        let attempts = self.attempts
+        let transport = self.transport
+        lock.unlock()
+
+        let report: @Sendable (MercadoPagoSDK.RequestTiming) -> Void = { transportTiming in
+            var timing = transportTiming
+            timing.decode = decode
+            timing.total = total
+            completion(
+                MercadoPagoSDK.RequestMetrics(
+                    endpoint: endpoint,
+                    statusCode: statusCode,
+                    attempts: attempts,
+                    timing: timing
+                )
+            )
+        }
+
+        guard let transport else { return report(MercadoPagoSDK.RequestTiming()) }
+        transport.whenCollected(report)
+    }
+}
+
+/// Task delegate keeping the `URLSessionTaskMetrics` of one attempt.
+final class TaskMetricsCollector: NSObject, URLSessionTaskDelegate, @unchecked Sendable {
+    private let lock = NSLock()
+    private var metrics: URLSessionTaskMetrics?
+    private var handler: (@Sendable (MercadoPagoSDK.RequestTiming) -> Void)?
+
+    func urlSession(_: URLSession, task _: URLSessionTask, didFinishCollecting metrics: URLSessionTaskMetrics) {
+        lock.lock()
+        self.metrics = metrics
+        let handler = self.handler
+        self.handler = nil
+        lock.unlock()
+
+        handler?(MercadoPagoSDK.RequestTiming(metrics: metrics))
+    }
+
+    /// Calls `handler` with the transport phases of the attempt: right away when the session
+    /// already reported them, otherwise once it does. Never called if the session never does.
+    func whenCollected(_ handler: @escaping @Sendable (MercadoPagoSDK.RequestTiming) -> Void) {
+        lock.lock()
+        guard let metrics else {
+            self.handler = handler
+            lock.unlock()
+            return
+        }
+        lock.unlock()
+
+        handler(MercadoPagoSDK.RequestTiming(metrics: metrics))
+    }
+}
+
+extension MercadoPagoSDK.RequestTiming {
+    /// Reads the phases of the last transaction of `metrics`, the one that produced the answer.
+    init(metrics: URLSessionTaskMetrics) {
+        self.init()
+
+        guard let transaction = metrics.transactionMetrics.last else { return }
+
+        self.reusedConnection = transaction.isReusedConnection
+        self.dns = Self.interval(transaction.domainLookupStartDate, transaction.domainLookupEndDate)
+        self.tls = Self.interval(transaction.secureConnectionStartDate, transaction.secureConnectionEndDate)
+        self.connect = Self.interval(
+            transaction.connectStartDate,
+            transaction.secureConnectionStartDate ?? transaction.connectEndDate
+        )
+        self.timeToFirstByte = Self.interval(transaction.requestStartDate, transaction.responseStartDate)
+        self.transfer = Self.interval(transaction.responseStartDate, transaction.responseEndDate)
+
+        let firstActivity = transaction.domainLookupStartDate
+            ?? transaction.connectStartDate
+            ?? transaction.requestStartDate
+        self.queueing = Self.interval(metrics.taskInterval.start, firstActivity)
+    }
+
+    private static func interval(_ start: Date?, _ end: Date?) -> TimeInterval? {
+        guard let start, let end, end >= start else { return nil }
+        return end.timeIntervalSince(start)
+    }
+}
@@ -1,81 +1,613 @@
 import Foundation
 
 protocol URLSessionProtocol: Sendable {
-    func data(for request: URLRequest) async throws -> (Data, URLResponse)
+    func data(for request: URLRequest, delegate: (any URLSessionTaskDelegate)?) async throws -> (Data, URLResponse)
+
+    /// Whether task delegates receive `urlSession(_:task:didFinishCollecting:)`.
+    var reportsTaskMetrics: Bool { get }
+}
+
+extension URLSessionProtocol {
+    var reportsTaskMetrics: Bool {
+        false
+    }
 }
 
-extension URLSession: URLSessionProtocol {}
+extension URLSession: URLSessionProtocol {
+    var reportsTaskMetrics: Bool {
+        true
+    }
+}
 
-package final class NetworkService: NetworkServiceProtocol {
+package final class NetworkService: NetworkServiceProtocol, @unchecked Sendable {
     // MARK: - Properties
 
-    private let session: URLSessionProtocol
+    private let lock = NSLock()
+
+    /// Session used to perform requests. Built lazily from `configuration` unless injected.
+    private var session: URLSessionProtocol?
+
+    /// Whether `session` was created by this service and can be rebuilt on reconfiguration.
+    private let ownsSession: Bool
+
+    private var configuration: MercadoPagoSDK.NetworkConfiguration
+
+    /// Shares identical in-flight GET requests between concurrent callers.
+    private let coalescer = RequestCoalescer()
+
+    /// Counters of GET requests started and coalesced into an in-flight request.
+    package var coalescingStatistics: RequestCoalescer.Statistics {
+        coalescer.statistics
+    }
+
+    /// Retries left for endpoints opting into a `RetryPolicy`.
+    private let retryBudget: RetryBudget
+
+    /// Hedging delays and budget for endpoints opting into a `HedgingPolicy`.
+    private let hedging: HedgingController
+
+    /// Counters of hedged requests.
+    package var hedgingStatistics: HedgingController.Statistics {
+        hedging.statistics
+    }
+
+    /// Per-endpoint timing histograms of completed requests.
+    package let metrics: NetworkMetricsRecorder?
+
+    /// Admits attempts per `RequestPriority` lane; shared with analytics uploads.
+    package let scheduler: RequestScheduler?
+
+    /// Fails attempts fast on endpoints opting into a `CircuitBreakerPolicy`.
+    package let circuitBreaker: CircuitBreaker?
+
+    /// Throttles attempts on endpoints opting into a `RateLimitPolicy`.
+    private let rateLimiter: RateLimiter
+
+    /// Uptime of the last request sent, used to skip keep-alive pings on a busy connection.
+    private var lastActivity: TimeInterval = 0
+
+    /// Number of active `retainConnections()` calls.
+    private var keepAliveRetainCount = 0
+
+    private var keepAliveTask: Task<Void, Never>?
+
     // MARK: - Initialization
 
-    init(session: URLSessionProtocol = URLSession.shared) {
-        let urlSessionConfiguration: URLSessionConfiguration = .default
-        if let cachesURL = FileManager.default.urls(for: .cachesDirectory, in: .userDomainMask).first {
-            let diskCacheURL = cachesURL.appendingPathComponent("MPCache")
+    init(
+        session: URLSessionProtocol? = nil,
+        configuration: MercadoPagoSDK.NetworkConfiguration = .default,
+        retryBudget: RetryBudget = RetryBudget(),
+        hedging: HedgingController = HedgingController(),
+        metrics: NetworkMetricsRecorder = NetworkMetricsRecorder(),
+        scheduler: RequestScheduler = RequestScheduler(),
+        circuitBreaker: CircuitBreaker = CircuitBreaker(),
+        rateLimiter: RateLimiter = RateLimiter()
+    ) {
+        self.session = session
+        self.ownsSession = session == nil
+        self.configuration = configuration
+        self.retryBudget = retryBudget
+        self.hedging = hedging
+        self.metrics = metrics
+        self.scheduler = scheduler
+        self.circuitBreaker = circuitBreaker
+        self.rateLimiter = rateLimiter
+    }
 
-            // Memory 10 MB e disk 100MB
-            let cache = URLCache(
-                memoryCapacity: 10 * 1024 * 1024,
-                diskCapacity: 100 * 1024 * 1024,
-                directory: diskCacheURL
-            )
-            urlSessionConfiguration.urlCache = cache
+    deinit {
+        keepAliveTask?.cancel()
+        if ownsSession, let session = session as? URLSession {
+            session.finishTasksAndInvalidate()
         }
-        
-        self.session = session
     }
 
     // MARK: - Methods
 
+    package func configure(_ configuration: MercadoPagoSDK.NetworkConfiguration) {
+        lock.lock()
+        defer { lock.unlock() }
+
+        guard self.configuration != configuration else { return }
+        self.configuration = configuration
+
+        guard ownsSession else { return }
+        (self.session as? URLSession)?.finishTasksAndInvalidate()
+        self.session = nil
+    }
+
+    package func prepare() {
+        _ = self.currentSession()
+    }
+
+    /// Sends a `HEAD` request to the API host and ignores the answer; the connection it opens
+    /// stays in the session pool for the next request.
+    package func preconnect() async {
+        guard let url = URL(string: Constants.apiHost) else { return }
+
+        var request = URLRequest(url: url)
+        request.httpMethod = HTTPMethod.head.rawValue
+        request.cachePolicy = .reloadIgnoringLocalCacheData
+
+        _ = try? await self.scheduled(.background) {
+            self.markActivity()
+            return try await self.currentSession().data(for: request, delegate: nil)
+        }
+    }
+
+    package func retainConnections() {
+        lock.lock()
+        defer { lock.unlock() }
+
+        keepAliveRetainCount += 1
+        guard keepAliveRetainCount == 1 else { return }
+
+        keepAliveTask = self.makeKeepAliveTask(interval: configuration.keepAliveInterval)
+    }
+
+    package func releaseConnections() {
+        lock.lock()
+        defer { lock.unlock() }
+
+        guard keepAliveRetainCount > 0 else { return }
+        keepAliveRetainCount -= 1
+        guard keepAliveRetainCount == 0 else { return }
+
+        keepAliveTask?.cancel()
+        keepAliveTask = nil
+    }
+
     package func request<T: Decodable & Sendable>(
         _ endpoint: any RequestEndpoint,
         decoder: JSONDecoder
     ) async throws -> T {
-        guard let request = endpoint.urlRequest else {
-            throw APIClientError.invalidURL
+        let request = try makeRequest(endpoint)
+        let retryPolicy = endpoint.retryPolicy
+        let hedgingPolicy = endpoint.hedgingPolicy
+        let traffic = TrafficControl(endpoint)
+        let path = endpoint.path
+        let priority = RequestPriority.override ?? endpoint.priority
+
+        return try await self.traced(endpoint, priority: priority) {
+            try await self.coalesced(request, priority: priority) {
+                let call = CallMetrics(priority: priority)
+                defer { call.finish(endpoint: path) { self.metrics?.record($0) } }
+
+                let (data, _) = try await self.performRequest(
+                    request,
+                    retryPolicy: retryPolicy,
+                    hedgingPolicy: hedgingPolicy,
+                    traffic: traffic,
+                    call: call
+                )
+
+                let decodeStart = ProcessInfo.processInfo.systemUptime
+                defer { call.recordDecode(ProcessInfo.processInfo.systemUptime - decodeStart) }
+                do {
+                    return try decoder.decode(T.self, from: data)
+                } catch {
+                    throw APIClientError.decodingFailed(error)
+                }
+            }
         }
+    }
 
-        let data = try await performRequest(request)
-        do {
-            return try decoder.decode(T.self, from: data)
-        } catch {
-            throw APIClientError.decodingFailed(error)
+    package func requestData(
+        _ endpoint: any RequestEndpoint,
+        additionalHeaders: [String: String]
+    ) async throws -> NetworkResponse {
+        let request = try makeRequest(endpoint, additionalHeaders: additionalHeaders)
+        let retryPolicy = endpoint.retryPolicy
+        let hedgingPolicy = endpoint.hedgingPolicy
+        let traffic = TrafficControl(endpoint)
+        let path = endpoint.path
+        let priority = RequestPriority.override ?? endpoint.priority
+
+        return try await self.traced(endpoint, priority: priority) {
+            try await self.coalesced(request, priority: priority) {
+                let call = CallMetrics(priority: priority)
+                defer { call.finish(endpoint: path) { self.metrics?.record($0) } }
+
+                let isConditional = request.value(forHTTPHeaderField: "If-None-Match") != nil
+                let (data, response) = try await self.performRequest(
+                    request,
+                    retryPolicy: retryPolicy,
+                    hedgingPolicy: hedgingPolicy,
+                    traffic: traffic,
+                    call: call,
+                    acceptsNotModified: isConditional
+                )
+
+                return NetworkResponse(
+                    data: data,
+                    statusCode: response.statusCode,
+                    etag: response.value(forHTTPHeaderField: "ETag")
+                )
+            }
         }
     }
 }
 
+// MARK: - Session Factory
+
+extension NetworkService {
+    /// Builds the `URLSessionConfiguration` backing the SDK session.
+    ///
+    /// The configuration wires the `MPCache` `URLCache` so cacheable endpoints (e.g. `CoreAPIEndpoint.getSiteID`)
+    /// are served locally, caps connections per host and keeps connections alive for reuse.
+    static func makeSessionConfiguration(
+        _ configuration: MercadoPagoSDK.NetworkConfiguration
+    ) -> URLSessionConfiguration {
+        let sessionConfiguration: URLSessionConfiguration = .default
+        sessionConfiguration.timeoutIntervalForRequest = configuration.requestTimeout
+        sessionConfiguration.timeoutIntervalForResource = configuration.resourceTimeout
+        sessionConfiguration.httpMaximumConnectionsPerHost = configuration.maximumConnectionsPerHost
+        sessionConfiguration.httpShouldSetCookies = false
+        sessionConfiguration.httpCookieAcceptPolicy = .never
+        sessionConfiguration.requestCachePolicy = .useProtocolCachePolicy
+        sessionConfiguration.waitsForConnectivity = false
+
+        if let cachesURL = FileManager.default.urls(for: .cachesDirectory, in: .userDomainMask).first {
+            let diskCacheURL = cachesURL.appendingPathComponent("MPCache")
+
+            sessionConfiguration.urlCache = URLCache(
+                memoryCapacity: configuration.memoryCacheCapacity,
+                diskCapacity: configuration.diskCacheCapacity,
+                directory: diskCacheURL
+            )
+        }
+
+        return sessionConfiguration
+    }
+}
+
 // MARK: - Private extensions -
 
 private extension NetworkService {
+    /// Returns the current session, creating the dedicated SDK session on first use.
+    func currentSession() -> URLSessionProtocol {
+        lock.lock()
+        defer { lock.unlock() }
+
+        if let session {
+            return session
+        }
+
+        let session = URLSession(configuration: Self.makeSessionConfiguration(self.configuration))
+        self.session = session
+        return session
+    }
+
+    func markActivity() {
+        lock.lock()
+        defer { lock.unlock() }
+        lastActivity = ProcessInfo.processInfo.systemUptime
+    }
+
+    /// Seconds since the last request was sent.
+    var idleTime: TimeInterval {
+        lock.lock()
+        defer { lock.unlock() }
+        return ProcessInfo.processInfo.systemUptime - lastActivity
+    }
+
+    /// Runs `operation` once the scheduler admits it on `priority`.
+    func scheduled<T>(_ priority: RequestPriority, operation: () async throws -> T) async throws -> T {
+        guard let scheduler else { return try await operation() }
+        return try await scheduler.run(priority, operation: operation)
+    }
+
+    /// Refreshes the connection every `interval` seconds unless a request used it meanwhile.
+    func makeKeepAliveTask(interval: TimeInterval) -> Task<Void, Never> {
+        Task(priority: .background) { [weak self] in
+            let nanoseconds = UInt64(max(interval, 0.01) * 1_000_000_000)
+
+            while !Task.isCancelled {
+                try? await Task.sleep(nanoseconds: nanoseconds)
+                guard let self, !Task.isCancelled else { return }
+
+                if self.idleTime >= interval {
+                    await self.preconnect()
+                }
+            }
+        }
+    }
+
+    /// Builds the request of `endpoint`, adding `additionalHeaders` and, when the retry policy asks for it,
+    /// an idempotency key shared by every attempt of this call.
+    func makeRequest(
+        _ endpoint: any RequestEndpoint,
+        additionalHeaders: [String: String] = [:]
+    ) throws -> URLRequest {
+        guard var request = endpoint.urlRequest else {
+            throw APIClientError.invalidURL
+        }
+
+        for (field, value) in additionalHeaders {
+            request.setValue(value, forHTTPHeaderField: field)
+        }
+
+        if endpoint.retryPolicy.attachesIdempotencyKey,
+           request.value(forHTTPHeaderField: RetryPolicy.idempotencyKeyHeader) == nil {
+            request.setValue(UUID().uuidString, forHTTPHeaderField: RetryPolicy.idempotencyKeyHeader)
+        }
+
+        return request
+    }
+
+    /// Runs `operation` in a tracing span named after the method and path of `endpoint`,
+    /// e.g. `POST card_tokens`.
+    func traced<T>(
+        _ endpoint: any RequestEndpoint,
+        priority: RequestPriority,
+        operation: () async throws -> T
+    ) async throws -> T {
+        try await MPTracer.shared.span(
+            endpoint.method.rawValue + " " + endpoint.path,
+            attributes: ["priority": priority.rawValue],
+            operation
+        )
+    }
+
+    /// Runs `operation` through the coalescer for GET requests, so concurrent identical lookups
+    /// (e.g. the same BIN typed in two fields) on the lane of `priority` share one round trip and
+    /// one decode. Other methods are never coalesced since they are not idempotent.
+    func coalesced<T: Sendable>(
+        _ request: URLRequest,
+        priority: RequestPriority,
+        operation: @escaping @Sendable () async throws -> T
+    ) async throws -> T {
+        guard request.httpMethod == HTTPMethod.get.rawValue else {
+            return try await operation()
+        }
+        return try await coalescer.perform(request, lane: priority, operation: operation)
+    }
+
+    /// Sends `request`, retrying transient failures as described by `retryPolicy`
+    /// and hedging each attempt as described by `hedgingPolicy`.
+    ///
+    /// Every attempt is first admitted by the rate limiter and circuit breaker of `traffic`.
+    /// A rejected first attempt throws `APIClientError.rateLimited` or `.circuitOpen`;
+    /// a rejected retry throws the error of the previous attempt.
     @discardableResult
     private func performRequest(
-        _ request: URLRequest
-    ) async throws -> Data {
-        let session: URLSessionProtocol = self.session
+        _ request: URLRequest,
+        retryPolicy: RetryPolicy,
+        hedgingPolicy: HedgingPolicy?,
+        traffic: TrafficControl,
+        call: CallMetrics,
+        acceptsNotModified: Bool = false
+    ) async throws -> (Data, HTTPURLResponse) {
+        var attempt = 1
+        var lastError: APIClientError?
 
-        do {
-            let (data, response) = try await session.data(for: request)
-
-            guard let httpResponse = response as? HTTPURLResponse else {
-                throw APIClientError.invalidResponse(data)
+        while true {
+            var admission: CircuitBreaker.Admission?
+            do {
+                admission = try self.admit(traffic)
+            } catch let rejection as APIClientError {
+                throw lastError ?? rejection
             }
 
-            guard (200 ... 299).contains(httpResponse.statusCode) else {
+            call.beginAttempt()
+
+            let error: APIClientError
+            let isRetryable: Bool
+            let outcome: CircuitBreaker.Outcome
+            var retryAfter: TimeInterval?
+
+            do {
+                let (data, response, answeredByHedge) = try await self.send(
+                    request,
+                    hedgingPolicy: hedgingPolicy,
+                    traffic: traffic,
+                    call: call
+                )
+                let statusCode = response.statusCode
+
+                // The hedge recorded its own outcome; the cancelled original tells nothing.
+                if answeredByHedge {
+                    self.record(.ignored, of: admission, traffic: traffic)
+                    admission = nil
+                }
+
+                if (200 ... 299).contains(statusCode) || acceptsNotModified && statusCode == 304 {
+                    self.record(.success, of: admission, traffic: traffic)
+                    retryBudget.deposit()
+                    return (data, response)
+                }
+
                 if let apiError = decodeAPIError(from: data) {
-                    throw APIClientError.apiError(apiError)
+                    error = .apiError(apiError)
                 } else {
-                    throw APIClientError.statusCode(httpResponse.statusCode)
+                    error = .statusCode(statusCode)
+                }
+                isRetryable = RetryPolicy.isRetryable(statusCode: statusCode)
+                outcome = isRetryable ? .failure : .success
+                retryAfter = RetryPolicy.retryAfter(from: response)
+
+                // Without `Retry-After`, the retry must still outlast the block of the limiter or its
+                // admission fails.
+                if statusCode == 429, let rateLimitPolicy = traffic.rateLimitPolicy {
+                    retryAfter = rateLimiter.throttle(traffic.endpoint, retryAfter: retryAfter, policy: rateLimitPolicy)
+                }
+            } catch let failure as APIClientError {
+                error = failure
+                isRetryable = RetryPolicy.isRetryable(failure)
+                outcome = isRetryable ? .failure : .ignored
+            }
+
+            self.record(outcome, of: admission, traffic: traffic)
+            lastError = error
+
+            guard isRetryable,
+                  attempt < retryPolicy.maximumAttempts,
+                  Self.isSafeToRetry(request),
+                  let delay = retryPolicy.delay(forRetry: attempt, retryAfter: retryAfter),
+                  retryBudget.withdraw() else {
+                throw error
+            }
+
+            try? await Task.sleep(nanoseconds: UInt64(delay * 1_000_000_000))
+            guard !Task.isCancelled else { throw error }
+
+            attempt += 1
+        }
+    }
+
+    /// Takes a token from the rate limiter, then admits the attempt through the circuit breaker.
+    ///
+    /// - Returns: The circuit breaker admission, `nil` when the endpoint has no circuit.
+    private func admit(_ traffic: TrafficControl) throws -> CircuitBreaker.Admission? {
+        if let rateLimitPolicy = traffic.rateLimitPolicy {
+            try rateLimiter.acquire(traffic.endpoint, policy: rateLimitPolicy)
+        }
+        guard let circuitBreakerPolicy = traffic.circuitBreakerPolicy else { return nil }
+        return try circuitBreaker?.admit(traffic.endpoint, policy: circuitBreakerPolicy)
+    }
+
+    private func record(
+        _ outcome: CircuitBreaker.Outcome,
+        of admission: CircuitBreaker.Admission?,
+        traffic: TrafficControl
+    ) {
+        guard let admission, let circuitBreakerPolicy = traffic.circuitBreakerPolicy else { return }
+        circuitBreaker?.record(outcome, for: admission, policy: circuitBreakerPolicy)
+    }
+
+    /// A request can be sent twice when it is a `GET` or carries an idempotency key.
+    private static func isSafeToRetry(_ request: URLRequest) -> Bool {
+        request.httpMethod == HTTPMethod.get.rawValue
+            || request.value(forHTTPHeaderField: RetryPolicy.idempotencyKeyHeader) != nil
+    }
+
+    /// Sends `request`, racing it against a delayed copy when `hedgingPolicy` is set and the request
+    /// is a `GET`. The first answer wins and the other request is cancelled. A failure of the original
+    /// request is returned right away so the retry policy can handle it.
+    ///
+    /// The copy is admitted by the rate limiter and circuit breaker of `traffic` like any attempt,
+    /// and records its own outcome; it is not sent when rejected.
+    ///
+    /// - Returns: The answer, and whether the copy sent it.
+    private func send(
+        _ request: URLRequest,
+        hedgingPolicy: HedgingPolicy?,
+        traffic: TrafficControl,
+        call: CallMetrics
+    ) async throws -> (Data, HTTPURLResponse, answeredByHedge: Bool) {
+        guard let hedgingPolicy, request.httpMethod == HTTPMethod.get.rawValue else {
+            let answer = try await self.send(request, call: call)
+            call.recordAnswer(statusCode: answer.response.statusCode, transport: answer.transport)
+            return (answer.data, answer.response, false)
+        }
+
+        let path = request.url?.path ?? ""
+        let delay = hedging.delay(for: path, policy: hedgingPolicy)
+
+        let outcome = await withTaskGroup(of: HedgeOutcome.self) { group -> HedgeOutcome in
+            group.addTask {
+                await self.timedSend(request, path: path, isHedge: false, call: call)
+            }
+            group.addTask {
+                try? await Task.sleep(nanoseconds: UInt64(delay * 1_000_000_000))
+                guard !Task.isCancelled else { return .skipped }
+
+                let admission: CircuitBreaker.Admission?
+                do {
+                    admission = try self.admit(traffic)
+                } catch {
+                    return .skipped
                 }
+                guard self.hedging.beginHedge() else {
+                    self.record(.ignored, of: admission, traffic: traffic)
+                    return .skipped
+                }
+
+                let outcome = await self.timedSend(request, path: path, isHedge: true, call: call)
+                self.record(outcome.circuitOutcome, of: admission, traffic: traffic)
+                return outcome
+            }
+
+            var hedgeFailure: HedgeOutcome?
+            for await outcome in group {
+                switch outcome {
+                case .skipped:
+                    continue
+                case .failure(_, isHedge: true):
+                    hedgeFailure = outcome
+                default:
+                    group.cancelAll()
+                    return outcome
+                }
+            }
+            return hedgeFailure ?? .skipped
+        }
+
+        // Only the copy whose answer is returned is recorded: the other one may still answer
+        // after it was cancelled.
+        switch outcome {
+        case let .response(answer, isHedge):
+            if isHedge {
+                hedging.recordHedgeWon()
             }
-            return data
+            call.recordAnswer(statusCode: answer.response.statusCode, transport: answer.transport)
+            return (answer.data, answer.response, isHedge)
+        case let .failure(error, _):
+            throw error
+        case .skipped:
+            throw APIClientError.networkError(URLError(.cancelled))
+        }
+    }
+
+    /// Sends one copy of a hedged request, recording its latency when it is answered.
+    private func timedSend(
+        _ request: URLRequest,
+        path: String,
+        isHedge: Bool,
+        call: CallMetrics
+    ) async -> HedgeOutcome {
+        let start = ProcessInfo.processInfo.systemUptime
+
+        do {
+            let answer = try await self.send(request, call: call)
+            hedging.record(ProcessInfo.processInfo.systemUptime - start, for: path)
+            return .response(answer, isHedge: isHedge)
+        } catch let error as APIClientError {
+            return .failure(error, isHedge: isHedge)
+        } catch {
+            return .failure(.requestFailed(error), isHedge: isHedge)
+        }
+    }
+
+    /// Sends a single attempt of `request` on the lane of `call`, mapping transport failures to
+    /// `APIClientError`.
+    ///
+    /// - Returns: The answer with the collector of its transport timing, which the caller records
+    ///   into `call` once it knows the answer is the one returned.
+    private func send(_ request: URLRequest, call: CallMetrics) async throws -> Answer {
+        let session: URLSessionProtocol = self.currentSession()
+        let collector = TaskMetricsCollector()
+
+        do {
+            let (data, response) = try await self.scheduled(call.priority) {
+                self.markActivity()
+                return try await session.data(for: request, delegate: collector)
+            }
+
+            guard let httpResponse = response as? HTTPURLResponse else {
+                throw APIClientError.invalidResponse(data)
+            }
+
+            return Answer(
+                data: data,
+                response: httpResponse,
+                transport: session.reportsTaskMetrics ? collector : nil
+            )
         } catch let error as URLError {
             throw APIClientError.networkError(error)
         } catch let error as APIClientError {
             throw error
+        } catch is CancellationError {
+            throw APIClientError.networkError(URLError(.cancelled))
         } catch {
             throw APIClientError.requestFailed(error)
         }
@@ -85,3 +617,49 @@ private extension NetworkService {
         return try? JSONDecoder().decode(APIErrorResponse.self, from: data)
     }
 }
+
+// MARK: - Traffic Control
+
+/// Circuit breaker and rate limit settings of the endpoint a call targets.
+private struct TrafficControl: Sendable {
+    /// Circuit and bucket of the endpoint, one per path.
+    let endpoint: String
+    let circuitBreakerPolicy: CircuitBreakerPolicy?
+    let rateLimitPolicy: RateLimitPolicy?
+
+    init(_ endpoint: any RequestEndpoint) {
+        self.endpoint = endpoint.path
+        self.circuitBreakerPolicy = endpoint.circuitBreakerPolicy
+        self.rateLimitPolicy = endpoint.rateLimitPolicy
+    }
+}
+
+// MARK: - Hedging
+
+/// Response of one attempt and the collector receiving its transport timing.
+private struct Answer: @unchecked Sendable {
+    let data: Data
+    let response: HTTPURLResponse
+    let transport: TaskMetricsCollector?
+}
+
+/// Result of one copy of a hedged request.
+/// `@unchecked` because `APIClientError` carries untyped errors; values only move between the
+/// children of a task group and its parent.
+private enum HedgeOutcome: @unchecked Sendable {
+    case response(Answer, isHedge: Bool)
+    case failure(APIClientError, isHedge: Bool)
+    case skipped
+
+    /// Outcome of the copy for the circuit breaker, classified like the attempts of `performRequest`.
+    var circuitOutcome: CircuitBreaker.Outcome {
+        switch self {
+        case let .response(answer, _):
+            return RetryPolicy.isRetryable(statusCode: answer.response.statusCode) ? .failure : .success
+        case let .failure(error, _):
+            return RetryPolicy.isRetryable(error) ? .failure : .ignored
+        case .skipped:
+            return .ignored
+        }
+    }
+}
@@ -15,6 +15,51 @@ package protocol NetworkServiceProtocol: Sendable {
         _ endpoint: any RequestEndpoint,
         decoder: JSONDecoder
     ) async throws -> T
+
+    /// Sends a request to the specified endpoint and returns the raw response body.
+    ///
+    /// Use this variant when the caller needs response metadata (e.g. `ETag`) to manage its own cache.
+    /// A `304 Not Modified` answer is treated as success when `additionalHeaders` carries `If-None-Match`.
+    ///
+    /// - Parameters:
+    ///   - endpoint: The endpoint to request.
+    ///   - additionalHeaders: Headers added on top of the endpoint headers, such as conditional request headers.
+    /// - Returns: The raw ``NetworkResponse``.
+    /// - Throws: An error if the request fails or the server answers with an unexpected status code.
+    func requestData(
+        _ endpoint: any RequestEndpoint,
+        additionalHeaders: [String: String]
+    ) async throws -> NetworkResponse
+
+    /// Applies new session tuning options.
+    ///
+    /// The underlying session is rebuilt lazily on the next request.
+    /// - Parameter configuration: The network options to apply.
+    func configure(_ configuration: MercadoPagoSDK.NetworkConfiguration)
+
+    /// Per-endpoint timing histograms of completed requests, when collected.
+    var metrics: NetworkMetricsRecorder? { get }
+
+    /// Lanes admitting requests by priority, when scheduled.
+    var scheduler: RequestScheduler? { get }
+
+    /// Per-endpoint circuits failing requests fast, when guarded.
+    var circuitBreaker: CircuitBreaker? { get }
+
+    /// Builds the session and its response cache now instead of on the first request.
+    func prepare()
+
+    /// Opens a connection to the API host so the next request skips DNS, TCP and TLS setup.
+    func preconnect() async
+
+    /// Keeps the API connection warm until the matching `releaseConnections()`.
+    ///
+    /// Calls are counted; while at least one is active, an idle connection is refreshed
+    /// every `NetworkConfiguration.keepAliveInterval`.
+    func retainConnections()
+
+    /// Balances a previous `retainConnections()`.
+    func releaseConnections()
 }
 
 package extension NetworkServiceProtocol {
@@ -22,4 +67,20 @@ package extension NetworkServiceProtocol {
     func request<T: Codable & Sendable>(_ endpoint: RequestEndpoint) async throws -> T {
         try await self.request(endpoint, decoder: JSONDecoder())
     }
+
+    func configure(_: MercadoPagoSDK.NetworkConfiguration) {}
+
+    var metrics: NetworkMetricsRecorder? { nil }
+
+    var scheduler: RequestScheduler? { nil }
+
+    var circuitBreaker: CircuitBreaker? { nil }
+
+    func prepare() {}
+
+    func preconnect() async {}
+
+    func retainConnections() {}
+
+    func releaseConnections() {}
 }
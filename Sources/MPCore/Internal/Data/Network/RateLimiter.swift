@@ -0,0 +1,77 @@
+//
+//  RateLimiter.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Token buckets throttling the attempts sent to each endpoint.
+///
+/// Buckets start full and refill continuously as described by their `RateLimitPolicy`.
+/// A `429` answer empties the bucket of the endpoint until its `Retry-After` elapsed, then
+/// lets a single attempt through before refilling.
+package final class RateLimiter: @unchecked Sendable {
+    private struct Bucket {
+        var tokens: Double
+        var refilledAt: TimeInterval
+        var blockedUntil: TimeInterval = 0
+    }
+
+    private let lock = NSLock()
+    private let now: @Sendable () -> TimeInterval
+    private var buckets: [String: Bucket] = [:]
+
+    /// Creates a limiter.
+    ///
+    /// - Parameter now: Clock of the limiter, in seconds.
+    package init(now: @escaping @Sendable () -> TimeInterval = { ProcessInfo.processInfo.systemUptime }) {
+        self.now = now
+    }
+
+    /// Takes a token from the bucket of `endpoint`.
+    ///
+    /// - Throws: `APIClientError.rateLimited` with the time until the next token.
+    package func acquire(_ endpoint: String, policy: RateLimitPolicy) throws {
+        lock.lock()
+        defer { lock.unlock() }
+
+        let now = self.now()
+        var bucket = buckets[endpoint] ?? Bucket(tokens: policy.capacity, refilledAt: now)
+        defer { buckets[endpoint] = bucket }
+
+        guard now >= bucket.blockedUntil else {
+            throw APIClientError.rateLimited(retryAfter: bucket.blockedUntil - now)
+        }
+
+        let elapsed = max(now - bucket.refilledAt, 0)
+        bucket.tokens = min(bucket.tokens + elapsed * policy.refillRate, policy.capacity)
+        bucket.refilledAt = now
+
+        guard bucket.tokens >= 1 else {
+            throw APIClientError.rateLimited(retryAfter: (1 - bucket.tokens) / policy.refillRate)
+        }
+        bucket.tokens -= 1
+    }
+
+    /// Blocks `endpoint` after a `429` answer.
+    ///
+    /// - Parameter retryAfter: Delay requested by the server; `policy.defaultBackoff` when `nil`.
+    /// - Returns: Time until the endpoint admits attempts again, which a retry must wait at least.
+    @discardableResult
+    package func throttle(_ endpoint: String, retryAfter: TimeInterval?, policy: RateLimitPolicy) -> TimeInterval {
+        lock.lock()
+        defer { lock.unlock() }
+
+        let now = self.now()
+        let blockedUntil = now + max(retryAfter ?? policy.defaultBackoff, 0)
+        var bucket = buckets[endpoint] ?? Bucket(tokens: policy.capacity, refilledAt: now)
+
+        bucket.blockedUntil = max(bucket.blockedUntil, blockedUntil)
+        bucket.tokens = 1
+        bucket.refilledAt = bucket.blockedUntil
+        buckets[endpoint] = bucket
+        return bucket.blockedUntil - now
+    }
+}
@@ -0,0 +1,185 @@
+//
+//  RequestCoalescer.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Shares a single in-flight operation between identical concurrent requests (single-flight).
+///
+/// Requests are keyed on method, URL, headers, body, scheduler lane and the expected result type.
+/// Callers on different lanes never share an operation, so an interactive request does not wait
+/// behind a background prefetch of the same URL. The first caller
+/// starts the operation; callers arriving while it is in flight wait for the same result instead of
+/// issuing their own round trip and decode. Each caller stays independently cancellable: cancelling
+/// a caller only detaches it, and the shared operation is cancelled once no caller is left.
+///
+/// Example:
+/// ```swift
+/// let value: [IssuersResponse] = try await coalescer.perform(request, lane: .interactive) {
+///     try await fetchAndDecode(request)
+/// }
+/// ```
+package final class RequestCoalescer: @unchecked Sendable {
+    /// Counters describing how many requests were coalesced.
+    package struct Statistics: Sendable, Equatable {
+        /// Number of operations actually started.
+        package var started = 0
+
+        /// Number of callers that joined an operation already in flight.
+        package var coalesced = 0
+    }
+
+    private struct Key: Hashable {
+        let method: String?
+        let url: URL?
+        let headers: [String: String]?
+        let body: Data?
+        let lane: RequestPriority
+        let resultType: ObjectIdentifier
+
+        init(request: URLRequest, lane: RequestPriority, resultType: Any.Type) {
+            self.method = request.httpMethod
+            self.url = request.url
+            self.headers = request.allHTTPHeaderFields
+            self.body = request.httpBody
+            self.lane = lane
+            self.resultType = ObjectIdentifier(resultType)
+        }
+    }
+
+    private final class Flight {
+        var task: Task<Void, Never>?
+        var waiters: [UInt64: CheckedContinuation<any Sendable, Error>] = [:]
+    }
+
+    private let lock = NSLock()
+    private var flights: [Key: Flight] = [:]
+    private var nextWaiterID: UInt64 = 0
+    private var counters = Statistics()
+
+    package init() {}
+
+    /// Current coalescing counters.
+    package var statistics: Statistics {
+        lock.lock()
+        defer { lock.unlock() }
+        return counters
+    }
+
+    /// Runs `operation`, or joins an identical operation already in flight for `request`.
+    /// - Parameters:
+    ///   - request: The fully built request identifying the operation.
+    ///   - lane: Scheduler lane the operation runs on.
+    ///   - operation: Work producing the shared result (network round trip and decode).
+    /// - Returns: The shared result.
+    /// - Throws: The operation error, or `CancellationError` when the calling task is cancelled.
+    package func perform<T: Sendable>(
+        _ request: URLRequest,
+        lane: RequestPriority,
+        operation: @escaping @Sendable () async throws -> T
+    ) async throws -> T {
+        let key = Key(request: request, lane: lane, resultType: T.self)
+        let waiterID = self.makeWaiterID()
+
+        let value = try await withTaskCancellationHandler {
+            try await withCheckedThrowingContinuation { continuation in
+                self.join(key, waiterID: waiterID, continuation: continuation, operation: operation)
+            }
+        } onCancel: {
+            self.leave(key, waiterID: waiterID)
+        }
+
+        // The key includes the result type, so joined callers always receive a `T`.
+        guard let result = value as? T else {
+            throw APIClientError.requestFailed(CancellationError())
+        }
+        return result
+    }
+}
+
+// MARK: - Private Methods
+
+private extension RequestCoalescer {
+    func makeWaiterID() -> UInt64 {
+        lock.lock()
+        defer { lock.unlock() }
+        nextWaiterID &+= 1
+        return nextWaiterID
+    }
+
+    func join<T: Sendable>(
+        _ key: Key,
+        waiterID: UInt64,
+        continuation: CheckedContinuation<any Sendable, Error>,
+        operation: @escaping @Sendable () async throws -> T
+    ) {
+        lock.lock()
+
+        if Task.isCancelled {
+            lock.unlock()
+            continuation.resume(throwing: CancellationError())
+            return
+        }
+
+        if let flight = flights[key] {
+            flight.waiters[waiterID] = continuation
+            counters.coalesced += 1
+            lock.unlock()
+            return
+        }
+
+        let flight = Flight()
+        flight.waiters[waiterID] = continuation
+        flights[key] = flight
+        counters.started += 1
+
+        flight.task = Task {
+            let result: Result<any Sendable, Error>
+            do {
+                result = .success(try await operation())
+            } catch {
+                result = .failure(error)
+            }
+            self.finish(key, flight: flight, with: result)
+        }
+
+        lock.unlock()
+    }
+
+    func leave(_ key: Key, waiterID: UInt64) {
+        lock.lock()
+
+        guard let flight = flights[key],
+              let continuation = flight.waiters.removeValue(forKey: waiterID) else {
+            lock.unlock()
+            return
+        }
+
+        if flight.waiters.isEmpty {
+            flights[key] = nil
+            flight.task?.cancel()
+        }
+
+        lock.unlock()
+        continuation.resume(throwing: CancellationError())
+    }
+
+    func finish(_ key: Key, flight: Flight, with result: Result<any Sendable, Error>) {
+        lock.lock()
+
+        if flights[key] === flight {
+            flights[key] = nil
+        }
+        let waiters = flight.waiters.values
+        flight.waiters.removeAll()
+
+        lock.unlock()
+
+        for continuation in waiters {
+            continuation.resume(with: result)
+        }
+    }
+}
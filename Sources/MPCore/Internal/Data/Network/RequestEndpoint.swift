@@ -45,12 +45,29 @@ package protocol RequestEndpoint {
 
     /// The cache policy to use when `isCacheable` is true.
     var cachePolicy: NSURLRequest.CachePolicy { get }
+
+    /// How transient failures of this request are retried. Defaults to `.none`.
+    var retryPolicy: RetryPolicy { get }
+
+    /// When a slow `GET` request is hedged with a second copy. Defaults to `nil` (never).
+    var hedgingPolicy: HedgingPolicy? { get }
+
+    /// Scheduler lane of the request. Defaults to `.interactive`.
+    var priority: RequestPriority { get }
+
+    /// When requests fail fast because the endpoint keeps failing. Defaults to `nil` (never).
+    var circuitBreakerPolicy: CircuitBreakerPolicy? { get }
+
+    /// Client-side token bucket of the endpoint. Defaults to `nil` (unlimited).
+    var rateLimitPolicy: RateLimitPolicy? { get }
 }
 
 package extension RequestEndpoint {
     /// A computed property that constructs and returns a `URLRequest` for the endpoint.
     ///
-    /// This property assembles a `URLRequest` by combining the base URL, API version, and path. It adds any query parameters and sets the HTTP method, headers, and body as specified by the endpoint.
+    /// The base URL, API version, path, method and public key are resolved once into a cached
+    /// `RequestTemplate`; each call only encodes the query parameters (sorted by name, `public_key`
+    /// included) and sets the headers and body.
     ///
     /// - Returns: A `URLRequest` if the URL components can be successfully created, otherwise `nil`.
     ///
@@ -60,26 +77,35 @@ package extension RequestEndpoint {
     /// // Use the request with URLSession or any networking library.
     /// ```
     var urlRequest: URLRequest? {
-        var components = URLComponents(string: baseURL + apiVersion.rawValue + path)
-        components?.queryItems = urlParams.map { key, value in
-            URLQueryItem(name: key, value: String(describing: value))
+        guard let template = RequestTemplate.template(for: self) else { return nil }
+
+        let params = urlParams
+        var query: [(name: String, value: String)] = []
+        query.reserveCapacity(params.count + 1)
+        for (name, value) in params {
+            query.append((name, value.description))
         }
+        query.append(("public_key", template.publicKey))
+
+        return template.makeRequest(
+            query: query,
+            headers: headers,
+            body: body,
+            cachePolicy: isCacheable ? cachePolicy : .reloadIgnoringLocalCacheData
+        )
+    }
 
-        let publicKey = MercadoPagoSDK.shared.getPublicKey()
-        components?.queryItems?.append(URLQueryItem(name: "public_key", value: publicKey))
+    var isCacheable: Bool { false }
 
-        guard let url = components?.url else { return nil }
+    var cachePolicy: NSURLRequest.CachePolicy { .useProtocolCachePolicy }
 
-        var request = URLRequest(url: url)
-        request.httpMethod = method.rawValue
-        request.allHTTPHeaderFields = headers
-        request.httpBody = body
-        request.cachePolicy = isCacheable ? cachePolicy : .reloadIgnoringLocalCacheData
+    var retryPolicy: RetryPolicy { .none }
 
-        return request
-    }
+    var hedgingPolicy: HedgingPolicy? { nil }
 
-    var isCacheable: Bool { false }
+    var priority: RequestPriority { .interactive }
 
-    var cachePolicy: NSURLRequest.CachePolicy { .useProtocolCachePolicy }
+    var circuitBreakerPolicy: CircuitBreakerPolicy? { nil }
+
+    var rateLimitPolicy: RateLimitPolicy? { nil }
 }
@@ -0,0 +1,203 @@
+//
+//  RequestScheduler.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+#if SWIFT_PACKAGE
+    import MPAnalytics
+#endif
+
+/// Admits SDK requests per `RequestPriority` lane.
+///
+/// Each lane has its own concurrency limit; requests over the limit wait in FIFO order.
+/// Background requests are also held back while a critical request is running or waiting,
+/// so prefetch and analytics never compete with tokenization for connections. Running
+/// background requests are not cancelled; preemption only applies to admission.
+package final class RequestScheduler: @unchecked Sendable {
+    /// Maximum number of requests running at once, per lane.
+    package struct Limits: Sendable, Equatable {
+        package var critical: Int
+        package var interactive: Int
+        package var background: Int
+
+        package static let `default` = Limits()
+
+        package init(critical: Int = 4, interactive: Int = 4, background: Int = 2) {
+            self.critical = critical
+            self.interactive = interactive
+            self.background = background
+        }
+
+        subscript(priority: RequestPriority) -> Int {
+            switch priority {
+            case .critical: return max(self.critical, 1)
+            case .interactive: return max(self.interactive, 1)
+            case .background: return max(self.background, 1)
+            }
+        }
+    }
+
+    struct Waiter {
+        let id: UInt64
+        let enqueuedAt: TimeInterval
+        let continuation: CheckedContinuation<Void, Error>
+    }
+
+    private let lock = NSLock()
+    private let limits: Limits
+    private let metrics: MPMetrics
+    private var running: [RequestPriority: Int] = [:]
+    private var waiting: [RequestPriority: [Waiter]] = [:]
+    private var lanes: [RequestPriority: MercadoPagoSDK.LaneMetrics] = [:]
+    private var nextID: UInt64 = 0
+
+    package init(limits: Limits = .default, metrics: MPMetrics = .shared) {
+        self.limits = limits
+        self.metrics = metrics
+    }
+
+    /// Queueing delay and admissions of every lane.
+    package func snapshot() -> [MercadoPagoSDK.LaneMetrics] {
+        lock.lock()
+        defer { lock.unlock() }
+        return RequestPriority.allCases.map { lanes[$0] ?? MercadoPagoSDK.LaneMetrics(priority: $0) }
+    }
+
+    /// Runs `operation` once `priority` has room for it.
+    ///
+    /// - Throws: `CancellationError` when the task is cancelled while waiting, or the error of `operation`.
+    package func run<T>(
+        _ priority: RequestPriority,
+        operation: () async throws -> T
+    ) async throws -> T {
+        try await self.acquire(priority)
+        self.reportInFlight()
+        defer {
+            self.release(priority)
+            self.reportInFlight()
+        }
+        return try await operation()
+    }
+
+    /// Waits for a slot on `priority`.
+    package func acquire(_ priority: RequestPriority) async throws {
+        let enqueuedAt = ProcessInfo.processInfo.systemUptime
+
+        lock.lock()
+        if waiting[priority, default: []].isEmpty, canAdmit(priority) {
+            running[priority, default: 0] += 1
+            recordAdmission(priority, delay: 0)
+            lock.unlock()
+            return
+        }
+        nextID += 1
+        let id = nextID
+        lock.unlock()
+
+        try await withTaskCancellationHandler {
+            try await withCheckedThrowingContinuation { (continuation: CheckedContinuation<Void, Error>) in
+                lock.lock()
+                defer { lock.unlock() }
+
+                guard !Task.isCancelled else {
+                    continuation.resume(throwing: CancellationError())
+                    return
+                }
+                // A slot may have been released since the first check.
+                if waiting[priority, default: []].isEmpty, canAdmit(priority) {
+                    running[priority, default: 0] += 1
+                    recordAdmission(priority, delay: ProcessInfo.processInfo.systemUptime - enqueuedAt)
+                    continuation.resume()
+                    return
+                }
+                waiting[priority, default: []].append(
+                    Waiter(id: id, enqueuedAt: enqueuedAt, continuation: continuation)
+                )
+            }
+        } onCancel: {
+            lock.lock()
+            let index = waiting[priority]?.firstIndex { $0.id == id }
+            let waiter = index.flatMap { waiting[priority]?.remove(at: $0) }
+            // A cancelled critical waiter may have been the only thing holding background back.
+            let admitted = admitWaiters()
+            lock.unlock()
+
+            waiter?.continuation.resume(throwing: CancellationError())
+            admitted.forEach { $0.continuation.resume() }
+        }
+    }
+
+    /// Frees a slot of `priority` and admits the waiters that now fit, critical lane first.
+    package func release(_ priority: RequestPriority) {
+        lock.lock()
+        running[priority, default: 0] -= 1
+        let admitted = admitWaiters()
+        lock.unlock()
+
+        admitted.forEach { $0.continuation.resume() }
+    }
+}
+
+// MARK: - Private Methods
+
+private extension RequestScheduler {
+    /// Must be called with `lock` held.
+    func canAdmit(_ priority: RequestPriority) -> Bool {
+        guard running[priority, default: 0] < limits[priority] else { return false }
+
+        if priority == .background {
+            return running[.critical, default: 0] == 0 && waiting[.critical, default: []].isEmpty
+        }
+        return true
+    }
+
+    /// Moves the waiters that now fit to running, critical lane first, and returns them
+    /// to be resumed once `lock` is released. Must be called with `lock` held.
+    func admitWaiters() -> [Waiter] {
+        var admitted: [Waiter] = []
+        let now = ProcessInfo.processInfo.systemUptime
+
+        for lane in RequestPriority.allCases {
+            while canAdmit(lane), let waiter = waiting[lane]?.first {
+                waiting[lane]?.removeFirst()
+                running[lane, default: 0] += 1
+                recordAdmission(lane, delay: now - waiter.enqueuedAt)
+                admitted.append(waiter)
+            }
+        }
+        return admitted
+    }
+
+    /// Sets `network.requests_in_flight` to the requests running across every lane.
+    ///
+    /// Publishes the scheduler's own count rather than adjusting the gauge, so enabling metrics
+    /// while requests are running never leaves it off by the increments that were skipped.
+    func reportInFlight() {
+        guard metrics.isEnabled else { return }
+
+        lock.lock()
+        defer { lock.unlock() }
+        metrics.set("network.requests_in_flight", to: Double(running.values.reduce(0, +)))
+    }
+
+    /// Must be called with `lock` held.
+    func recordAdmission(_ priority: RequestPriority, delay: TimeInterval) {
+        var lane = lanes[priority] ?? MercadoPagoSDK.LaneMetrics(priority: priority)
+        lane.requests += 1
+        lane.queueing.record(delay)
+        lanes[priority] = lane
+    }
+}
+
+// MARK: - Analytics
+
+extension RequestScheduler: AnalyticsUploadGate {
+    /// Track uploads run on the background lane.
+    package func perform(_ upload: () async throws -> Void) async throws {
+        try await self.run(.background, operation: upload)
+    }
+}
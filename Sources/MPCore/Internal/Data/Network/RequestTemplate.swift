@@ -0,0 +1,145 @@
+//
+//  RequestTemplate.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// The fixed part of an endpoint request, resolved once and reused by every call.
+///
+/// A template holds the percent-encoded `baseURL + apiVersion + path`, the method and the
+/// public key set by `MercadoPagoSDK.initialize(_:)`. Per call, only the query string and body
+/// are filled in. Query parameters, including `public_key`, are sorted by name so the same
+/// parameters always produce the same URL (and the same `URLCache` key).
+package struct RequestTemplate: Sendable {
+    /// Identity of a template: everything it resolves.
+    struct Key: Hashable {
+        let method: HTTPMethod
+        let baseURL: String
+        let apiVersion: APIVersion
+        let path: String
+    }
+
+    /// `scheme://host/version/path` without query.
+    let urlPrefix: String
+
+    let method: String
+
+    /// Value of the `public_key` query parameter; empty before initialization.
+    let publicKey: String
+
+    /// Compiles the template of `key`.
+    ///
+    /// - Returns: `nil` when the URL cannot be built.
+    init?(key: Key, publicKey: String = "") {
+        guard let components = URLComponents(string: key.baseURL + key.apiVersion.rawValue + key.path),
+              components.url != nil else {
+            return nil
+        }
+
+        var prefix = components
+        prefix.query = nil
+        guard let urlPrefix = prefix.string else { return nil }
+
+        self.urlPrefix = urlPrefix
+        self.method = key.method.rawValue
+        self.publicKey = publicKey
+    }
+
+    /// Builds a request from the template.
+    ///
+    /// - Parameters:
+    ///   - query: Query parameters; sorted by name before encoding.
+    ///   - headers: Request headers.
+    ///   - body: Request body.
+    ///   - cachePolicy: Cache policy of the request.
+    func makeRequest(
+        query: [(name: String, value: String)],
+        headers: [String: String],
+        body: Data?,
+        cachePolicy: NSURLRequest.CachePolicy
+    ) -> URLRequest? {
+        var url = self.urlPrefix
+        url.reserveCapacity(url.utf8.count + query.count * 24)
+
+        for (index, item) in query.sorted(by: { $0.name < $1.name }).enumerated() {
+            url.append(index == 0 ? "?" : "&")
+            url.append(Self.encode(item.name))
+            url.append("=")
+            url.append(Self.encode(item.value))
+        }
+
+        guard let resolvedURL = URL(string: url) else { return nil }
+
+        var request = URLRequest(url: resolvedURL)
+        request.httpMethod = self.method
+        request.allHTTPHeaderFields = headers
+        request.httpBody = body
+        request.cachePolicy = cachePolicy
+        return request
+    }
+
+    /// Characters left as is in query names and values (RFC 3986 unreserved).
+    private static let allowedCharacters = CharacterSet(
+        charactersIn: "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-._~"
+    )
+
+    private static func encode(_ value: String) -> String {
+        value.addingPercentEncoding(withAllowedCharacters: self.allowedCharacters) ?? value
+    }
+}
+
+// MARK: - Cache
+
+extension RequestTemplate {
+    private final class Cache: @unchecked Sendable {
+        private let lock = NSLock()
+        private var templates: [Key: RequestTemplate] = [:]
+        private var publicKey = ""
+
+        /// Recompiles every template with `publicKey` on its next use.
+        func setPublicKey(_ publicKey: String) {
+            lock.lock()
+            defer { lock.unlock() }
+
+            guard self.publicKey != publicKey else { return }
+            self.publicKey = publicKey
+            templates.removeAll()
+        }
+
+        func template(for key: Key) -> RequestTemplate? {
+            lock.lock()
+            defer { lock.unlock() }
+
+            if let template = templates[key] {
+                return template
+            }
+
+            let template = RequestTemplate(key: key, publicKey: publicKey)
+            templates[key] = template
+            return template
+        }
+    }
+
+    private static let cache = Cache()
+
+    /// Sets the public key captured by every template. Called by `MercadoPagoSDK.initialize(_:)`,
+    /// so building a request never looks the key up.
+    static func setPublicKey(_ publicKey: String) {
+        self.cache.setPublicKey(publicKey)
+    }
+
+    /// Returns the compiled template of `endpoint`, compiling it on first use.
+    static func template(for endpoint: some RequestEndpoint) -> RequestTemplate? {
+        self.cache.template(
+            for: Key(
+                method: endpoint.method,
+                baseURL: endpoint.baseURL,
+                apiVersion: endpoint.apiVersion,
+                path: endpoint.path
+            )
+        )
+    }
+}
@@ -0,0 +1,58 @@
+//
+//  RetryBudget.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Caps the share of retries across all requests of a `NetworkService`.
+///
+/// Each retry withdraws one token and each successful request deposits `depositPerSuccess`,
+/// up to `capacity`. When the backend is down, retries stop once the budget is spent instead
+/// of multiplying the load by `RetryPolicy.maximumAttempts`.
+package final class RetryBudget: @unchecked Sendable {
+    private let lock = NSLock()
+
+    private let capacity: Double
+    private let depositPerSuccess: Double
+    private var tokens: Double
+
+    /// Creates a budget.
+    ///
+    /// - Parameters:
+    ///   - capacity: Maximum number of retries that can be spent in a burst.
+    ///   - depositPerSuccess: Tokens regained per successful request. `0.2` allows one retry every five requests.
+    package init(capacity: Double = 10, depositPerSuccess: Double = 0.2) {
+        self.capacity = capacity
+        self.depositPerSuccess = depositPerSuccess
+        self.tokens = capacity
+    }
+
+    /// Tokens left in the budget.
+    package var available: Double {
+        lock.lock()
+        defer { lock.unlock() }
+        return tokens
+    }
+
+    /// Withdraws one retry from the budget.
+    ///
+    /// - Returns: `false` when the budget is spent and the request must not be retried.
+    package func withdraw() -> Bool {
+        lock.lock()
+        defer { lock.unlock() }
+
+        guard tokens >= 1 else { return false }
+        tokens -= 1
+        return true
+    }
+
+    /// Records a successful request.
+    package func deposit() {
+        lock.lock()
+        defer { lock.unlock() }
+        tokens = min(tokens + depositPerSuccess, capacity)
+    }
+}
@@ -5,47 +5,55 @@
 //  Created by Guilherme Prata Costa on 12/02/25.
 //
 
-protocol FetchSiteIDUseCaseProtocol {
+protocol FetchSiteIDUseCaseProtocol: Sendable {
+    /// Site ID persisted for `publicKey` by a previous launch, if any.
+    func storedSiteID(for publicKey: String) -> String?
+
     func getSiteID(with publicKey: String, and country: MercadoPagoSDK.Country) async -> String
 }
 
 enum FetchSiteIDUseCaseFactory {
     static func make(dependencies: CoreDependencyContainer) -> FetchSiteIDUseCase {
         let repository = SiteRepository(dependencies: dependencies)
-        return FetchSiteIDUseCase(dependencies: dependencies, repository: repository)
+        return FetchSiteIDUseCase(dependencies: dependencies, repository: repository, store: .makeDefault())
     }
 }
 
 final class FetchSiteIDUseCase: FetchSiteIDUseCaseProtocol {
     private let repository: SiteRepositoryProtocol
 
+    private let store: SiteIDStore
+
     typealias Dependency = HasNoDependency
 
     private let dependencies: Dependency
 
-    var currentRetry = 0
-    let maxRetry = 3
-
-    init(dependencies: Dependency, repository: SiteRepositoryProtocol) {
+    init(
+        dependencies: Dependency,
+        repository: SiteRepositoryProtocol,
+        store: SiteIDStore = SiteIDStore(fileURL: nil)
+    ) {
         self.dependencies = dependencies
         self.repository = repository
+        self.store = store
+    }
+
+    func storedSiteID(for publicKey: String) -> String? {
+        self.store.siteID(for: publicKey)
     }
 
+    /// Fetches the site ID and persists it for `publicKey`.
+    ///
+    /// When the request fails, falls back to the persisted site ID, then to the site of `country`.
+    /// Transient failures are retried by `NetworkService` through the `getSiteID` retry policy.
     func getSiteID(with publicKey: String, and country: MercadoPagoSDK.Country) async -> String {
         do {
             let response = try await repository.getID()
 
+            self.store.store(response.id, for: publicKey)
             return response.id
-            
-        } catch _ as APIClientError {
-            if self.currentRetry < self.maxRetry {
-                self.currentRetry += 1
-                return await self.getSiteID(with: publicKey, and: country)
-            }
-
-            return country.getSiteId()
         } catch {
-            return country.getSiteId()
+            return self.store.siteID(for: publicKey) ?? country.getSiteId()
         }
     }
 }
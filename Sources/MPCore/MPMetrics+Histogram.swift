@@ -0,0 +1,95 @@
+//
+//  MPMetrics+Histogram.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+extension MPMetrics {
+    /// Distribution of durations over log-linear buckets, in the style of HDR histograms.
+    ///
+    /// Durations are counted in microseconds. Each power of two is split into
+    /// `subBucketCount` linear buckets, so any percentile is reported within about 6% of the
+    /// recorded value, from 1 µs up to several hours, in a fixed amount of memory.
+    public struct Histogram: Sendable, Equatable {
+        /// Linear buckets per power of two.
+        static let subBucketCount = 16
+
+        /// Highest power of two tracked; longer durations land in the last bucket.
+        static let maximumMagnitude = 35
+
+        static let bucketCount = (maximumMagnitude - 2) * subBucketCount
+
+        private var counts = [UInt32](repeating: 0, count: Self.bucketCount)
+
+        /// Number of recorded durations.
+        public private(set) var count = 0
+
+        /// Sum of recorded durations, in seconds.
+        public private(set) var sum: TimeInterval = 0
+
+        /// Shortest recorded duration, in seconds; `0` when empty.
+        public private(set) var min: TimeInterval = 0
+
+        /// Longest recorded duration, in seconds; `0` when empty.
+        public private(set) var max: TimeInterval = 0
+
+        public init() {}
+
+        /// Mean duration, or `nil` when empty.
+        public var mean: TimeInterval? {
+            self.count > 0 ? self.sum / Double(self.count) : nil
+        }
+
+        /// Duration below which `percentile` (in `0 ... 1`) of the recorded durations fall,
+        /// or `nil` when empty.
+        public func percentile(_ percentile: Double) -> TimeInterval? {
+            guard self.count > 0 else { return nil }
+
+            let rank = Swift.max(Int((percentile * Double(self.count)).rounded(.up)), 1)
+            var seen = 0
+            for (index, bucketCount) in self.counts.enumerated() where bucketCount > 0 {
+                seen += Int(bucketCount)
+                if seen >= rank {
+                    let upperBound = Double(Self.upperBound(of: index)) / 1_000_000
+                    return Swift.min(Swift.max(upperBound, self.min), self.max)
+                }
+            }
+            return self.max
+        }
+
+        mutating func record(_ duration: TimeInterval) {
+            let duration = Swift.max(duration, 0)
+            let microseconds = UInt64(Swift.min(duration * 1_000_000, Double(UInt64.max >> 1)))
+
+            self.counts[Self.bucket(of: microseconds)] += 1
+            self.min = self.count == 0 ? duration : Swift.min(self.min, duration)
+            self.max = Swift.max(self.max, duration)
+            self.count += 1
+            self.sum += duration
+        }
+
+        /// Bucket of `value`: values below `subBucketCount` have their own bucket; larger values
+        /// keep their 4 most significant bits.
+        static func bucket(of value: UInt64) -> Int {
+            let magnitude = UInt64.bitWidth - value.leadingZeroBitCount - 1
+            guard value >= UInt64(Self.subBucketCount) else { return Int(value) }
+            guard magnitude <= Self.maximumMagnitude else { return Self.bucketCount - 1 }
+
+            let shift = magnitude - 4
+            let subBucket = Int(value >> UInt64(shift))
+            return (shift + 1) * Self.subBucketCount + subBucket - Self.subBucketCount
+        }
+
+        /// Smallest value above every value of bucket `index`.
+        static func upperBound(of index: Int) -> UInt64 {
+            guard index >= Self.subBucketCount else { return UInt64(index + 1) }
+
+            let shift = index / Self.subBucketCount - 1
+            let subBucket = UInt64(index % Self.subBucketCount + Self.subBucketCount)
+            return (subBucket + 1) << UInt64(shift)
+        }
+    }
+}
@@ -0,0 +1,221 @@
+//
+//  MPMetrics.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Registry of the counters, gauges and latency histograms measured by the SDK itself.
+///
+/// Every public operation of `CoreMethods`, `MPApplePay` and `MPThreeDS` records its duration
+/// under a named histogram, together with the internal steps it spends time on (mapping,
+/// device fingerprint, field validation per keystroke). Metrics are off by default; while
+/// disabled, instruments cost a single flag check: an atomic load from iOS 18, a read under the
+/// flag's own lock on earlier versions. Enabled instruments are spread over shards with their own
+/// lock, so recording one instrument never waits for an unrelated one.
+///
+/// Example:
+/// ```swift
+/// MPMetrics.shared.isEnabled = true
+/// MPMetrics.shared.addExporter(DashboardExporter())
+///
+/// // Pull
+/// let tokenization = MPMetrics.shared.snapshot().histograms["core_methods.tokenization"]
+/// print(tokenization?.percentile(0.99) ?? 0)
+///
+/// // Push to every exporter, e.g. when the app moves to background
+/// await MPMetrics.shared.export()
+/// ```
+public final class MPMetrics: @unchecked Sendable {
+    /// Values of every instrument at a point in time.
+    public struct Snapshot: Sendable, Equatable {
+        /// Monotonic counters, e.g. `core_methods.tokenization.errors`.
+        public let counters: [String: Int]
+
+        /// Last value set on each gauge, e.g. `network.requests_in_flight`.
+        public let gauges: [String: Double]
+
+        /// Durations of each measured operation.
+        public let histograms: [String: Histogram]
+
+        public let date: Date
+    }
+
+    public static let shared = MPMetrics()
+
+    private static let shardCount = 8
+
+    private let lock = NSLock()
+    private let enabled = AtomicFlag(false)
+    private let shards = (0 ..< MPMetrics.shardCount).map { _ in Shard() }
+    private var exporters: [any MPMetricsExporter] = []
+
+    package init() {}
+
+    /// Whether instruments record values. Disabling keeps the values recorded so far.
+    public var isEnabled: Bool {
+        get { enabled.value }
+        set { enabled.value = newValue }
+    }
+
+    /// Values of every instrument recorded since launch or the last `reset()`.
+    ///
+    /// Shards are read one after the other, so values recorded meanwhile may be missing.
+    public func snapshot() -> Snapshot {
+        var counters: [String: Int] = [:]
+        var gauges: [String: Double] = [:]
+        var histograms: [String: Histogram] = [:]
+
+        for shard in shards {
+            shard.lock.lock()
+            counters.merge(shard.counters) { $1 }
+            gauges.merge(shard.gauges) { $1 }
+            histograms.merge(shard.histograms) { $1 }
+            shard.lock.unlock()
+        }
+        return Snapshot(counters: counters, gauges: gauges, histograms: histograms, date: Date())
+    }
+
+    /// Removes every recorded value.
+    public func reset() {
+        for shard in shards {
+            shard.lock.lock()
+            shard.counters.removeAll()
+            shard.gauges.removeAll()
+            shard.histograms.removeAll()
+            shard.lock.unlock()
+        }
+    }
+
+    /// Adds an exporter receiving a snapshot on each `export()`.
+    public func addExporter(_ exporter: any MPMetricsExporter) {
+        lock.lock()
+        defer { lock.unlock() }
+        exporters.append(exporter)
+    }
+
+    /// Sends a snapshot to every exporter, one after the other.
+    public func export() async {
+        lock.lock()
+        let exporters = self.exporters
+        lock.unlock()
+
+        guard !exporters.isEmpty else { return }
+
+        let snapshot = self.snapshot()
+        for exporter in exporters {
+            await exporter.export(snapshot)
+        }
+    }
+}
+
+// MARK: - Shards
+
+private extension MPMetrics {
+    /// Instruments whose names hash to the same shard, behind their own lock.
+    final class Shard: @unchecked Sendable {
+        let lock = NSLock()
+        var counters: [String: Int] = [:]
+        var gauges: [String: Double] = [:]
+        var histograms: [String: Histogram] = [:]
+    }
+
+    func shard(for name: String) -> Shard {
+        shards[Int(UInt(bitPattern: name.hashValue) % UInt(shards.count))]
+    }
+
+    /// Adds `duration` to the histogram `name`, whether or not metrics are enabled.
+    func store(_ name: String, duration: TimeInterval) {
+        let shard = self.shard(for: name)
+        shard.lock.lock()
+        defer { shard.lock.unlock() }
+        shard.histograms[name, default: Histogram()].record(duration)
+    }
+}
+
+/// Receives the snapshots of `MPMetrics`, e.g. to forward them to a dashboard.
+public protocol MPMetricsExporter: Sendable {
+    func export(_ snapshot: MPMetrics.Snapshot) async
+}
+
+// MARK: - Instruments
+
+package extension MPMetrics {
+    /// Adds `value` to the counter `name`.
+    func increment(_ name: String, by value: Int = 1) {
+        guard enabled.value else { return }
+
+        let shard = self.shard(for: name)
+        shard.lock.lock()
+        defer { shard.lock.unlock() }
+        shard.counters[name, default: 0] += value
+    }
+
+    /// Sets the gauge `name`.
+    func set(_ name: String, to value: Double) {
+        guard enabled.value else { return }
+
+        let shard = self.shard(for: name)
+        shard.lock.lock()
+        defer { shard.lock.unlock() }
+        shard.gauges[name] = value
+    }
+
+    /// Adds `delta` to the gauge `name`, starting from `0` and never going below it.
+    ///
+    /// Decrements paired with increments skipped while metrics were disabled would otherwise
+    /// drive the gauge negative.
+    func adjust(_ name: String, by delta: Double) {
+        guard enabled.value else { return }
+
+        let shard = self.shard(for: name)
+        shard.lock.lock()
+        defer { shard.lock.unlock() }
+        shard.gauges[name] = max(shard.gauges[name, default: 0] + delta, 0)
+    }
+
+    /// Adds `duration` to the histogram `name`.
+    func record(_ name: String, duration: TimeInterval) {
+        guard enabled.value else { return }
+        self.store(name, duration: duration)
+    }
+
+    /// Runs `operation`, recording its duration under `name` and counting `name.errors` when it throws.
+    @discardableResult
+    func measure<T, E: Error>(_ name: String, _ operation: () throws(E) -> T) throws(E) -> T {
+        guard self.isEnabled else { return try operation() }
+
+        let start = ProcessInfo.processInfo.systemUptime
+        do throws(E) {
+            let value = try operation()
+            self.store(name, duration: ProcessInfo.processInfo.systemUptime - start)
+            return value
+        } catch {
+            self.store(name, duration: ProcessInfo.processInfo.systemUptime - start)
+            self.increment(name + ".errors")
+            throw error
+        }
+    }
+
+    /// Runs `operation`, recording its duration under `name` and counting `name.errors` when it throws.
+    @discardableResult
+    func measure<T, E: Error>(
+        _ name: String,
+        _ operation: () async throws(E) -> T
+    ) async throws(E) -> T {
+        guard self.isEnabled else { return try await operation() }
+
+        let start = ProcessInfo.processInfo.systemUptime
+        do throws(E) {
+            let value = try await operation()
+            self.store(name, duration: ProcessInfo.processInfo.systemUptime - start)
+            return value
+        } catch {
+            self.store(name, duration: ProcessInfo.processInfo.systemUptime - start)
+            self.increment(name + ".errors")
+            throw error
+        }
+    }
+}
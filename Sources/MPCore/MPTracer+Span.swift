@@ -0,0 +1,73 @@
+//
+//  MPTracer+Span.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+extension MPTracer {
+    /// A finished span, or an instant when `isInstant` is `true`.
+    public struct Span: Sendable, Equatable {
+        /// Operation name, e.g. `core_methods.payment_methods` or `GET card_issuers`.
+        public let name: String
+
+        /// 32 hex digits shared by every span of a trace.
+        public let traceID: String
+
+        /// 16 hex digits.
+        public let spanID: String
+
+        /// Span this one was started from; `nil` for a top-level span.
+        public let parentSpanID: String?
+
+        public let start: Date
+
+        /// Duration in seconds; `0` for instants.
+        public let duration: TimeInterval
+
+        public let attributes: [String: String]
+
+        /// Whether the operation threw.
+        public let isError: Bool
+
+        /// Whether the span marks an instant, e.g. the first keystroke, rather than an operation.
+        public let isInstant: Bool
+
+        /// Top-level span of this one; empty for top-level instants.
+        let rootSpanID: String
+    }
+}
+
+/// Fixed-capacity buffer keeping the latest spans.
+struct SpanRingBuffer {
+    let capacity: Int
+
+    private var storage: [MPTracer.Span] = []
+    private var next = 0
+
+    init(capacity: Int) {
+        self.capacity = max(capacity, 1)
+    }
+
+    /// Spans, oldest first.
+    var elements: [MPTracer.Span] {
+        guard storage.count == capacity else { return storage }
+        return Array(storage[next...] + storage[..<next])
+    }
+
+    mutating func append(_ span: MPTracer.Span) {
+        if storage.count < capacity {
+            storage.append(span)
+        } else {
+            storage[next] = span
+        }
+        next = (next + 1) % capacity
+    }
+
+    mutating func removeAll() {
+        storage.removeAll(keepingCapacity: true)
+        next = 0
+    }
+}
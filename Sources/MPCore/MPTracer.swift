@@ -0,0 +1,264 @@
+//
+//  MPTracer.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+/// Records the timeline of a checkout as parent/child spans.
+///
+/// The SDK opens a span around each `CoreMethods` operation, its network calls, the device
+/// fingerprint collection and the 3DS steps, and marks instants of the card number field
+/// (created, first keystroke, BIN complete). Child spans find their parent through a task-local,
+/// so spans started from the `async` work of an operation nest under it.
+///
+/// Spans are kept in a ring buffer holding the latest `capacity` spans. Tracing is off by default.
+///
+/// Example:
+/// ```swift
+/// MPTracer.shared.isEnabled = true
+/// MPTracer.shared.startTrace()
+///
+/// // ... run the checkout ...
+///
+/// let url = FileManager.default.temporaryDirectory.appendingPathComponent("checkout.json")
+/// try MPTracer.shared.write(.chromeTrace, to: url) // open in chrome://tracing or Perfetto
+/// ```
+public final class MPTracer: @unchecked Sendable {
+    /// File formats of `export(_:)`.
+    public enum Format: Sendable {
+        /// Chrome `trace_event` JSON, for `chrome://tracing` and Perfetto.
+        case chromeTrace
+        /// OpenTelemetry OTLP-JSON `ExportTraceServiceRequest`.
+        case otlpJSON
+    }
+
+    /// Identity of the span a task runs in.
+    package struct Context: Sendable, Equatable {
+        let traceID: String
+        let spanID: String
+        /// Span of the top-level operation; spans sharing it are drawn on the same row.
+        let rootSpanID: String
+    }
+
+    /// Span started by `begin(_:attributes:)`, finished by `end(_:isError:)`.
+    package struct ActiveSpan: Sendable {
+        package let context: Context
+        let name: String
+        let parentSpanID: String?
+        let attributes: [String: String]
+        let start: Date
+        let startUptime: TimeInterval
+    }
+
+    /// Span the current task runs in, if any.
+    @TaskLocal package static var current: Context?
+
+    public static let shared = MPTracer()
+
+    private let lock = NSLock()
+    private var enabled = false
+    private var traceID = MPTracer.makeID(bytes: 16)
+    private var buffer: SpanRingBuffer
+
+    /// Creates a tracer.
+    ///
+    /// - Parameter capacity: Number of latest spans kept.
+    package init(capacity: Int = 2048) {
+        self.buffer = SpanRingBuffer(capacity: capacity)
+    }
+
+    /// Whether spans are recorded. Disabling keeps the spans recorded so far.
+    public var isEnabled: Bool {
+        get {
+            lock.lock()
+            defer { lock.unlock() }
+            return enabled
+        }
+        set {
+            lock.lock()
+            defer { lock.unlock() }
+            enabled = newValue
+        }
+    }
+
+    /// Starts a new trace: top-level spans recorded from now on get a new trace ID.
+    /// Call it when a checkout starts so each checkout reads as one timeline.
+    public func startTrace() {
+        lock.lock()
+        defer { lock.unlock() }
+        traceID = Self.makeID(bytes: 16)
+    }
+
+    /// Recorded spans, oldest first.
+    public func spans() -> [Span] {
+        lock.lock()
+        defer { lock.unlock() }
+        return buffer.elements
+    }
+
+    /// Removes every recorded span.
+    public func removeAll() {
+        lock.lock()
+        defer { lock.unlock() }
+        buffer.removeAll()
+    }
+
+    /// Encodes the recorded spans in `format`.
+    public func export(_ format: Format) -> Data {
+        let spans = self.spans()
+
+        switch format {
+        case .chromeTrace:
+            return TraceEncoder.chromeTrace(spans)
+        case .otlpJSON:
+            return TraceEncoder.otlpJSON(spans)
+        }
+    }
+
+    /// Writes the recorded spans in `format` to the file at `url`, replacing it.
+    public func write(_ format: Format, to url: URL) throws {
+        try self.export(format).write(to: url, options: .atomic)
+    }
+}
+
+// MARK: - Recording
+
+package extension MPTracer {
+    /// Starts a span, child of the span of the current task.
+    ///
+    /// - Returns: `nil` while tracing is disabled.
+    func begin(_ name: String, attributes: [String: String] = [:]) -> ActiveSpan? {
+        lock.lock()
+        guard enabled else {
+            lock.unlock()
+            return nil
+        }
+        let traceID = self.traceID
+        lock.unlock()
+
+        let parent = Self.current
+        let spanID = Self.makeID(bytes: 8)
+        return ActiveSpan(
+            context: Context(
+                traceID: parent?.traceID ?? traceID,
+                spanID: spanID,
+                rootSpanID: parent?.rootSpanID ?? spanID
+            ),
+            name: name,
+            parentSpanID: parent?.spanID,
+            attributes: attributes,
+            start: Date(),
+            startUptime: ProcessInfo.processInfo.systemUptime
+        )
+    }
+
+    /// Finishes `span` and adds it to the ring buffer.
+    func end(_ span: ActiveSpan?, isError: Bool = false) {
+        guard let span else { return }
+
+        self.append(
+            Span(
+                name: span.name,
+                traceID: span.context.traceID,
+                spanID: span.context.spanID,
+                parentSpanID: span.parentSpanID,
+                start: span.start,
+                duration: ProcessInfo.processInfo.systemUptime - span.startUptime,
+                attributes: span.attributes,
+                isError: isError,
+                isInstant: false,
+                rootSpanID: span.context.rootSpanID
+            )
+        )
+    }
+
+    /// Marks an instant, e.g. the first keystroke, in the span of the current task.
+    func event(_ name: String, attributes: [String: String] = [:]) {
+        guard let span = self.begin(name, attributes: attributes) else { return }
+
+        self.append(
+            Span(
+                name: name,
+                traceID: span.context.traceID,
+                spanID: span.context.spanID,
+                parentSpanID: span.parentSpanID,
+                start: span.start,
+                duration: 0,
+                attributes: attributes,
+                isError: false,
+                isInstant: true,
+                rootSpanID: span.parentSpanID == nil ? "" : span.context.rootSpanID
+            )
+        )
+    }
+
+    /// Runs `operation` in a span named `name`; spans it starts become its children.
+    func span<T, E: Error>(
+        _ name: String,
+        attributes: [String: String] = [:],
+        _ operation: () throws(E) -> T
+    ) throws(E) -> T {
+        guard let span = self.begin(name, attributes: attributes) else { return try operation() }
+
+        let result: Result<T, E> = Self.$current.withValue(span.context) {
+            do throws(E) {
+                return .success(try operation())
+            } catch {
+                return .failure(error)
+            }
+        }
+        self.end(span, isError: Self.isFailure(result))
+        return try result.get()
+    }
+
+    /// Runs `operation` in a span named `name`; spans it starts become its children.
+    func span<T, E: Error>(
+        _ name: String,
+        attributes: [String: String] = [:],
+        _ operation: () async throws(E) -> T
+    ) async throws(E) -> T {
+        guard let span = self.begin(name, attributes: attributes) else { return try await operation() }
+
+        let result: Result<T, E> = await Self.$current.withValue(span.context) {
+            do throws(E) {
+                return .success(try await operation())
+            } catch {
+                return .failure(error)
+            }
+        }
+        self.end(span, isError: Self.isFailure(result))
+        return try result.get()
+    }
+}
+
+// MARK: - Private Methods
+
+private extension MPTracer {
+    func append(_ span: Span) {
+        lock.lock()
+        defer { lock.unlock() }
+        buffer.append(span)
+    }
+
+    static func isFailure<T, E>(_ result: Result<T, E>) -> Bool {
+        if case .failure = result {
+            return true
+        }
+        return false
+    }
+
+    /// Random lowercase hex identifier of `bytes` bytes, as used by W3C trace context.
+    static func makeID(bytes: Int) -> String {
+        var id = ""
+        id.reserveCapacity(bytes * 2)
+        for _ in 0 ..< bytes / 8 {
+            let value = UInt64.random(in: 1 ... .max)
+            let hex = String(value, radix: 16)
+            id += String(repeating: "0", count: 16 - hex.count) + hex
+        }
+        return id
+    }
+}
@@ -0,0 +1,84 @@
+//
+//  MercadoPagoSDK+NetworkConfiguration.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+extension MercadoPagoSDK {
+    /// Tuning options for the dedicated `URLSession` used by the SDK.
+    ///
+    /// The SDK never shares `URLSession.shared` with the host app. All requests go through
+    /// a single long-lived session, so connections (HTTP/2 multiplexed when the server supports it)
+    /// are reused across BIN lookups, installments and tokenization.
+    ///
+    /// Example:
+    /// ```swift
+    /// let network = MercadoPagoSDK.NetworkConfiguration(
+    ///     requestTimeout: 10,
+    ///     maximumConnectionsPerHost: 2
+    /// )
+    /// let configuration = MercadoPagoSDK.Configuration(
+    ///     publicKey: "public_key_here",
+    ///     country: .ARG,
+    ///     network: network
+    /// )
+    /// ```
+    public struct NetworkConfiguration: Sendable, Equatable {
+        /// Time, in seconds, a request waits for additional data before timing out.
+        public let requestTimeout: TimeInterval
+
+        /// Maximum time, in seconds, a whole resource load may take.
+        public let resourceTimeout: TimeInterval
+
+        /// Maximum number of simultaneous connections opened to a single host.
+        public let maximumConnectionsPerHost: Int
+
+        /// In-memory capacity, in bytes, of the SDK `URLCache`.
+        public let memoryCacheCapacity: Int
+
+        /// On-disk capacity, in bytes, of the SDK `URLCache`.
+        public let diskCacheCapacity: Int
+
+        /// Whether `initialize(_:)` opens a connection to the Mercado Pago API ahead of the first request,
+        /// so DNS, TCP and TLS setup do not delay the first tokenization or BIN lookup.
+        public let preconnectsOnInitialize: Bool
+
+        /// Idle time, in seconds, after which the connection is refreshed while secure fields are on screen.
+        /// Should stay below the server idle timeout.
+        public let keepAliveInterval: TimeInterval
+
+        /// Default values: 15s request timeout, 30s resource timeout, 4 connections per host,
+        /// 10 MB memory cache, 100 MB disk cache, preconnect on initialize and a 25s keep-alive.
+        public static let `default` = NetworkConfiguration()
+
+        /// Creates a network configuration.
+        /// - Parameters:
+        ///   - requestTimeout: Time, in seconds, a request waits for additional data.
+        ///   - resourceTimeout: Maximum time, in seconds, a whole resource load may take.
+        ///   - maximumConnectionsPerHost: Maximum number of simultaneous connections per host.
+        ///   - memoryCacheCapacity: In-memory capacity, in bytes, of the response cache.
+        ///   - diskCacheCapacity: On-disk capacity, in bytes, of the response cache.
+        ///   - preconnectsOnInitialize: Whether `initialize(_:)` opens a connection ahead of the first request.
+        ///   - keepAliveInterval: Idle time, in seconds, after which a visible checkout refreshes the connection.
+        public init(
+            requestTimeout: TimeInterval = 15,
+            resourceTimeout: TimeInterval = 30,
+            maximumConnectionsPerHost: Int = 4,
+            memoryCacheCapacity: Int = 10 * 1024 * 1024,
+            diskCacheCapacity: Int = 100 * 1024 * 1024,
+            preconnectsOnInitialize: Bool = true,
+            keepAliveInterval: TimeInterval = 25
+        ) {
+            self.requestTimeout = requestTimeout
+            self.resourceTimeout = resourceTimeout
+            self.maximumConnectionsPerHost = maximumConnectionsPerHost
+            self.memoryCacheCapacity = memoryCacheCapacity
+            self.diskCacheCapacity = diskCacheCapacity
+            self.preconnectsOnInitialize = preconnectsOnInitialize
+            self.keepAliveInterval = keepAliveInterval
+        }
+    }
+}
@@ -0,0 +1,218 @@
+//
+//  MercadoPagoSDK+NetworkMetrics.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+extension MercadoPagoSDK {
+    /// Where the time of a request went.
+    ///
+    /// Transport phases come from the `URLSessionTaskMetrics` of the attempt that answered;
+    /// they are `nil` when the phase did not happen (e.g. DNS and TLS on a reused connection).
+    public struct RequestTiming: Sendable, Equatable {
+        /// Phases of a request.
+        public enum Phase: String, Sendable, CaseIterable {
+            /// Time between the task start and the first network activity.
+            case queueing
+            /// Domain name lookup.
+            case dns
+            /// TCP connection, excluding TLS.
+            case connect
+            /// TLS handshake.
+            case tls
+            /// Time between sending the request and receiving the first response byte.
+            case timeToFirstByte
+            /// Time receiving the response body.
+            case transfer
+            /// Decoding the response into SDK models.
+            case decode
+            /// Whole call, including retries, hedging and decoding.
+            case total
+        }
+
+        public var queueing: TimeInterval?
+        public var dns: TimeInterval?
+        public var connect: TimeInterval?
+        public var tls: TimeInterval?
+        public var timeToFirstByte: TimeInterval?
+        public var transfer: TimeInterval?
+        public var decode: TimeInterval?
+        public var total: TimeInterval?
+
+        /// Whether the answering attempt reused an open connection.
+        public var reusedConnection = false
+
+        public init() {}
+
+        /// Duration of `phase`, if it was measured.
+        public func duration(of phase: Phase) -> TimeInterval? {
+            switch phase {
+            case .queueing: return self.queueing
+            case .dns: return self.dns
+            case .connect: return self.connect
+            case .tls: return self.tls
+            case .timeToFirstByte: return self.timeToFirstByte
+            case .transfer: return self.transfer
+            case .decode: return self.decode
+            case .total: return self.total
+            }
+        }
+    }
+
+    /// Timing of one SDK request, delivered to the handler set with `setNetworkMetricsHandler(_:)`.
+    public struct RequestMetrics: Sendable, Equatable {
+        /// Endpoint path, e.g. `card_tokens` or `payment_methods`.
+        public let endpoint: String
+
+        /// HTTP status code of the answer, or `nil` when no answer was received.
+        public let statusCode: Int?
+
+        /// Attempts sent, including retries (hedged copies are not counted).
+        public let attempts: Int
+
+        public let timing: RequestTiming
+    }
+
+    /// Distribution of durations over fixed buckets.
+    public struct LatencyHistogram: Sendable, Equatable {
+        /// Upper bounds, in seconds, of the buckets. A last bucket collects longer durations.
+        public static let bucketBounds: [TimeInterval] = [
+            0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10
+        ]
+
+        /// Number of durations per bucket; `bucketCounts.count == bucketBounds.count + 1`.
+        public private(set) var bucketCounts = [Int](repeating: 0, count: Self.bucketBounds.count + 1)
+
+        /// Number of recorded durations.
+        public private(set) var count = 0
+
+        /// Sum of recorded durations, in seconds.
+        public private(set) var sum: TimeInterval = 0
+
+        public init() {}
+
+        /// Mean duration, or `nil` when empty.
+        public var mean: TimeInterval? {
+            self.count > 0 ? self.sum / Double(self.count) : nil
+        }
+
+        /// Upper bound of the bucket holding the `percentile` (in `0 ... 1`) duration.
+        ///
+        /// - Returns: `nil` when empty, `.infinity` when it falls past the last bound.
+        public func percentile(_ percentile: Double) -> TimeInterval? {
+            guard self.count > 0 else { return nil }
+
+            let rank = max(Int((percentile * Double(self.count)).rounded(.up)), 1)
+            var seen = 0
+            for (index, bucketCount) in self.bucketCounts.enumerated() {
+                seen += bucketCount
+                if seen >= rank {
+                    return index < Self.bucketBounds.count ? Self.bucketBounds[index] : .infinity
+                }
+            }
+            return .infinity
+        }
+
+        mutating func record(_ duration: TimeInterval) {
+            let index = Self.bucketBounds.firstIndex { duration <= $0 } ?? Self.bucketBounds.count
+            self.bucketCounts[index] += 1
+            self.count += 1
+            self.sum += duration
+        }
+    }
+
+    /// Latency histograms of one endpoint, per phase.
+    public struct EndpointMetrics: Sendable, Equatable {
+        /// Endpoint path, e.g. `card_tokens` or `payment_methods`.
+        public let endpoint: String
+
+        /// Histograms of the measured phases.
+        public internal(set) var phases: [RequestTiming.Phase: LatencyHistogram] = [:]
+
+        /// Number of completed requests.
+        public internal(set) var requests = 0
+
+        /// Number of requests that needed more than one attempt.
+        public internal(set) var retried = 0
+    }
+
+    /// Admissions and queueing delay of one scheduler lane.
+    public struct LaneMetrics: Sendable, Equatable {
+        public let priority: RequestPriority
+
+        /// Time requests waited for a slot on the lane before being sent.
+        public internal(set) var queueing = LatencyHistogram()
+
+        /// Number of requests admitted on the lane, including retries and hedges.
+        public internal(set) var requests = 0
+    }
+
+    /// State of the circuit guarding an endpoint.
+    public enum CircuitState: String, Sendable, CaseIterable {
+        /// Requests are sent.
+        case closed
+        /// Requests fail fast with `APIClientError.circuitOpen`.
+        case open
+        /// A probe request is sent to check whether the endpoint recovered.
+        case halfOpen
+    }
+
+    /// State and transitions of the circuit of one endpoint.
+    public struct CircuitMetrics: Sendable, Equatable {
+        /// Endpoint path, e.g. `payment_methods`.
+        public let endpoint: String
+
+        public internal(set) var state = CircuitState.closed
+
+        /// Number of times the circuit opened, from closed or after a failed probe.
+        public internal(set) var opened = 0
+
+        /// Number of times the circuit let probes through.
+        public internal(set) var halfOpened = 0
+
+        /// Number of times the circuit closed after successful probes.
+        public internal(set) var closed = 0
+
+        /// Number of requests failed fast.
+        public internal(set) var rejected = 0
+    }
+
+    /// Latency histograms collected since launch, one entry per endpoint.
+    ///
+    /// Example:
+    /// ```swift
+    /// for metrics in MercadoPagoSDK.shared.networkMetrics() {
+    ///     let ttfb = metrics.phases[.timeToFirstByte]?.percentile(0.99)
+    ///     print(metrics.endpoint, ttfb ?? 0)
+    /// }
+    /// ```
+    public func networkMetrics() -> [EndpointMetrics] {
+        self.dependencies.networkService.metrics?.snapshot() ?? []
+    }
+
+    /// Queueing delay of each scheduler lane since launch, in `RequestPriority` order.
+    ///
+    /// Critical requests (card tokenization) are never queued behind background work;
+    /// background requests (prefetch, analytics uploads) wait while a critical request runs.
+    public func laneMetrics() -> [LaneMetrics] {
+        self.dependencies.networkService.scheduler?.snapshot() ?? []
+    }
+
+    /// Circuit breaker state of each endpoint that has received a request, sorted by endpoint.
+    ///
+    /// While the lookups of an endpoint keep timing out or failing with `5xx`, its circuit opens
+    /// and requests fail fast with `APIClientError.circuitOpen` instead of reaching the network.
+    public func circuitMetrics() -> [CircuitMetrics] {
+        self.dependencies.networkService.circuitBreaker?.snapshot() ?? []
+    }
+
+    /// Sets a handler called with the timing of every SDK request, or removes it with `nil`.
+    ///
+    /// The handler runs on the task that completed the request; keep it short.
+    public func setNetworkMetricsHandler(_ handler: (@Sendable (RequestMetrics) -> Void)?) {
+        self.dependencies.networkService.metrics?.setHandler(handler)
+    }
+}
@@ -0,0 +1,116 @@
+//
+//  MercadoPagoSDK+Startup.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import Foundation
+
+extension MercadoPagoSDK {
+    /// When `initialize(_:)` starts the SDK subsystems.
+    ///
+    /// Example:
+    /// ```swift
+    /// // application(_:didFinishLaunchingWithOptions:)
+    /// let configuration = MercadoPagoSDK.Configuration(
+    ///     publicKey: "public_key_here",
+    ///     country: .ARG,
+    ///     startup: .deferred
+    /// )
+    /// MercadoPagoSDK.shared.initialize(configuration)
+    ///
+    /// // Once the first screen is visible
+    /// MercadoPagoSDK.shared.warmUp()
+    /// ```
+    public enum StartupMode: Sendable, Equatable {
+        /// `initialize(_:)` resolves the site ID, preconnects and initializes analytics right away.
+        case immediate
+        /// `initialize(_:)` only records the configuration. The subsystems start on `warmUp()`
+        /// or on the first call to an SDK API, whichever comes first.
+        case deferred
+    }
+
+    /// Time the SDK spent on its caller's thread while starting, in microseconds.
+    public struct StartupMetrics: Sendable, Equatable {
+        /// Mode passed to `initialize(_:)`; `nil` before initialization.
+        public internal(set) var mode: StartupMode?
+
+        /// Building `MercadoPagoSDK.shared`.
+        public internal(set) var sharedInstanceMicroseconds: UInt64 = 0
+
+        /// `initialize(_:)`. With ``StartupMode/immediate`` it includes `startMicroseconds`.
+        public internal(set) var initializeMicroseconds: UInt64 = 0
+
+        /// Starting the subsystems; off the launch path with ``StartupMode/deferred``.
+        public internal(set) var startMicroseconds: UInt64 = 0
+
+        /// Time the SDK added to app start when initialized from the app delegate.
+        public var launchMicroseconds: UInt64 {
+            self.sharedInstanceMicroseconds + self.initializeMicroseconds
+        }
+    }
+
+    /// Starts the subsystems deferred by ``StartupMode/deferred`` and builds the network session,
+    /// so the first checkout does not pay for them.
+    ///
+    /// Call it from an idle point after launch, e.g. once the first screen is visible. Does
+    /// nothing before `initialize(_:)`; later calls are ignored.
+    public func warmUp() {
+        guard self.isInitialized else { return }
+
+        self.startIfNeeded()
+        Task(priority: .utility) { [dependencies] in
+            dependencies.networkService.prepare()
+        }
+    }
+
+    /// Time the SDK spent on its caller's thread while starting.
+    public func startupMetrics() -> StartupMetrics {
+        self.startupRecorder.metrics
+    }
+}
+
+/// Accumulates the `StartupMetrics` of the SDK and reports them to `MPMetrics`.
+final class StartupRecorder: @unchecked Sendable {
+    /// Startup steps, named after their `MPMetrics` histogram.
+    enum Step: String {
+        case sharedInstance = "sdk.startup.shared_instance"
+        case initialize = "sdk.startup.initialize"
+        case start = "sdk.startup.start"
+    }
+
+    private let lock = NSLock()
+    private var storage = MercadoPagoSDK.StartupMetrics()
+
+    var metrics: MercadoPagoSDK.StartupMetrics {
+        lock.lock()
+        defer { lock.unlock() }
+        return storage
+    }
+
+    func setMode(_ mode: MercadoPagoSDK.StartupMode) {
+        lock.lock()
+        defer { lock.unlock() }
+        storage.mode = mode
+    }
+
+    /// Records the time elapsed since the uptime `start` for `step`.
+    func record(_ step: Step, since start: TimeInterval) {
+        let duration = ProcessInfo.processInfo.systemUptime - start
+        let microseconds = UInt64(max(duration, 0) * 1_000_000)
+
+        lock.lock()
+        switch step {
+        case .sharedInstance:
+            storage.sharedInstanceMicroseconds = microseconds
+        case .initialize:
+            storage.initializeMicroseconds = microseconds
+        case .start:
+            storage.startMicroseconds = microseconds
+        }
+        lock.unlock()
+
+        MPMetrics.shared.record(step.rawValue, duration: duration)
+    }
+}
@@ -14,83 +14,277 @@ import Foundation
 /// Main entry point for MercadoPago SDK
 public final class MercadoPagoSDK: @unchecked Sendable {
     public static let shared: MercadoPagoSDK = {
+        let start = ProcessInfo.processInfo.systemUptime
         let container = CoreDependencyContainer.shared
-        let useCase = FetchSiteIDUseCaseFactory.make(dependencies: container)
 
-        return MercadoPagoSDK(dependencies: container, useCase: useCase)
+        let sdk = MercadoPagoSDK(
+            dependencies: container,
+            useCase: FetchSiteIDUseCaseFactory.make(dependencies: container),
+            publishesPublicKey: true
+        )
+        sdk.startupRecorder.record(.sharedInstance, since: start)
+        return sdk
     }()
 
-    var siteIDUseCase: FetchSiteIDUseCaseProtocol
+    /// Built on first use: its store looks up the caches directory.
+    var siteIDUseCase: FetchSiteIDUseCaseProtocol {
+        self.lazySiteIDUseCase.value
+    }
+
+    private let lazySiteIDUseCase: LazyDependency<FetchSiteIDUseCaseProtocol>
 
     private let lock = NSLock()
 
+    /// Serializes the start of the subsystems, so concurrent first uses wait for the one
+    /// starting them instead of seeing a half-started SDK.
+    private let startLock = NSLock()
+
     /// Configuration options for MercadoPagoSDK
     public struct Configuration: Sendable {
         let publicKey: String
         package let locale: String
         package let country: MercadoPagoSDK.Country
+        package let network: NetworkConfiguration
+        package let startup: StartupMode
 
         /// Initialize SDK configuration
         /// - Parameters:
         ///   - publicKey: Your MercadoPago public key
         ///   - locale: Locale identifier (defaults to system locale)
         ///   - country: The country code of your Mercado Pago associated with the public key. It uses the ISO 3166-1 alpha-3 standard.
+        ///   - network: Tuning options for the SDK network session (defaults to ``NetworkConfiguration/default``)
+        ///   - startup: When `initialize(_:)` starts the SDK subsystems (defaults to ``StartupMode/immediate``)
         public init(
             publicKey: String,
             locale: String = Locale.current.identifier,
-            country: Country
+            country: Country,
+            network: NetworkConfiguration = .default,
+            startup: StartupMode = .immediate
         ) {
             self.publicKey = publicKey
             self.locale = locale
             self.country = country
+            self.network = network
+            self.startup = startup
         }
     }
 
-    private(set) var isInitialized = false
+    /// Whether `initialize(_:)` was called.
+    var isInitialized: Bool {
+        lock.lock()
+        defer { lock.unlock() }
+        return initialized
+    }
+
+    private var initialized = false
     package var configuration: Configuration?
-    private(set) var analyticsMonitoringTask: Task<Void, Never>?
 
-    typealias Dependency = HasAnalytics
+    var analyticsMonitoringTask: Task<Void, Never>? {
+        lock.lock()
+        defer { lock.unlock() }
+        return startTasks?.analyticsMonitoring
+    }
+
+    var preconnectTask: Task<Void, Never>? {
+        lock.lock()
+        defer { lock.unlock() }
+        return startTasks?.preconnect
+    }
+
+    var siteIDTask: Task<String, Never>? {
+        lock.lock()
+        defer { lock.unlock() }
+        return startTasks?.siteID
+    }
+
+    /// Site ID resolved for the configured public key; `nil` until known.
+    private var resolvedSiteID: String?
+
+    /// Tasks launched by the start of the subsystems, by `initialize(_:)`, `warmUp()` or a
+    /// first use; `nil` until started.
+    private var startTasks: StartTasks?
+
+    /// Time spent on the caller's thread by the startup steps.
+    let startupRecorder = StartupRecorder()
 
-    private let dependencies: Dependency
+    typealias Dependency = HasAnalytics & HasNetwork
 
-    init(dependencies: Dependency, useCase: FetchSiteIDUseCaseProtocol) {
+    let dependencies: Dependency
+
+    /// Whether `initialize(_:)` sets the public key of the process-wide `RequestTemplate`s;
+    /// only the shared instance does.
+    private let publishesPublicKey: Bool
+
+    init(
+        dependencies: Dependency,
+        useCase: @autoclosure @escaping @Sendable () -> FetchSiteIDUseCaseProtocol,
+        publishesPublicKey: Bool = false
+    ) {
         self.dependencies = dependencies
-        self.siteIDUseCase = useCase
+        self.lazySiteIDUseCase = LazyDependency(useCase)
+        self.publishesPublicKey = publishesPublicKey
     }
 
     /// Initialize the SDK with required configuration
     /// Should call only once, when app open (AppDelegate, SceneDelegate or @main
+    ///
+    /// With ``StartupMode/deferred``, only the configuration is recorded; the subsystems start
+    /// on ``warmUp()`` or on the first call to an SDK API.
     /// - Parameter configuration: SDK configuration options
     public func initialize(_ configuration: Configuration) {
+        let start = ProcessInfo.processInfo.systemUptime
+        defer { self.startupRecorder.record(.initialize, since: start) }
+
         verifyCanBeInitialized(configuration)
-        
+
+        lock.lock()
         self.configuration = configuration
-        self.isInitialized = true
+        self.initialized = true
+        lock.unlock()
+        self.startupRecorder.setMode(configuration.startup)
+
+        if self.publishesPublicKey {
+            RequestTemplate.setPublicKey(configuration.publicKey)
+        }
+
+        guard configuration.startup == .immediate else { return }
+        self.startIfNeeded()
+    }
+
+    /// Starts the subsystems: applies the network configuration, resolves the site ID,
+    /// preconnects and initializes analytics. Runs once, after `initialize(_:)`; callers racing
+    /// the first start return once its tasks are published.
+    ///
+    /// Called by `initialize(_:)` in ``StartupMode/immediate``, by `warmUp()` and by the public
+    /// entry points of the SDK modules; never on the path building a request.
+    package func startIfNeeded() {
+        guard self.configurationToStart() != nil else { return }
+
+        startLock.lock()
+        defer { startLock.unlock() }
+
+        guard let configuration = self.configurationToStart() else { return }
+
+        let start = ProcessInfo.processInfo.systemUptime
+        defer { self.startupRecorder.record(.start, since: start) }
+
+        self.dependencies.networkService.configure(configuration.network)
+
+        // A site ID persisted by a previous launch is used as soon as it is read and revalidated
+        // in background. Reading it touches the caches directory, so it stays off the caller's thread.
+        let storedSiteIDTask = Task(priority: .utility) {
+            let storedSiteID = self.siteIDUseCase.storedSiteID(for: configuration.publicKey)
+            self.setSiteID(storedSiteID)
+            return storedSiteID
+        }
+
+        let siteIDTask = Task(priority: .utility) {
+            // Waits for the stored value so it never overwrites a fresher answer.
+            _ = await storedSiteIDTask.value
+            let siteID = await self.siteIDUseCase.getSiteID(with: configuration.publicKey, and: configuration.country)
+            self.setSiteID(siteID)
+            return siteID
+        }
+
+        var preconnectTask: Task<Void, Never>?
+        if configuration.network.preconnectsOnInitialize {
+            preconnectTask = Task(priority: .background) { [dependencies] in
+                await dependencies.networkService.preconnect()
+            }
+        }
+
+        let analyticsMonitoringTask = Task(priority: .background) {
+            if let scheduler = self.dependencies.networkService.scheduler {
+                await self.dependencies.analytics.setUploadGate(scheduler)
+            }
+
+            let siteID: String
+            if let storedSiteID = await storedSiteIDTask.value {
+                siteID = storedSiteID
+            } else {
+                siteID = await siteIDTask.value
+            }
 
-        self.analyticsMonitoringTask = Task(priority: .background) {
             await self.dependencies.analytics.initialize(
                 version: MPSDKVersion.version,
-                siteID: configuration.country.getSiteId()
+                siteID: siteID
             )
-            
+
+            // A site ID resolved while analytics was initializing did not reach its context.
+            self.updateAnalyticsSiteID()
+
             await sendInitializeAnalyticsEvent()
         }
+
+        lock.lock()
+        startTasks = StartTasks(
+            siteID: siteIDTask,
+            preconnect: preconnectTask,
+            analyticsMonitoring: analyticsMonitoringTask
+        )
+        lock.unlock()
     }
 
     /// Get the configured public key
-    /// - Returns: The public key string
+    /// - Returns: The public key string; empty before initialization.
     package func getPublicKey() -> String {
-        guard let key = configuration?.publicKey else {
-            assert(self.configuration?.publicKey.isEmpty ?? true, SDKError.notInitialized.rawValue)
-            return ""
-        }
+        lock.lock()
+        defer { lock.unlock() }
+        return configuration?.publicKey ?? ""
+    }
 
-        return key
+    /// Waits until the site ID of the configured public key is resolved.
+    /// Does nothing before initialization.
+    package func prefetchSiteID() async {
+        self.startIfNeeded()
+        _ = await self.siteIDTask?.value
+    }
+
+    /// Site ID resolved for the configured public key. Until the API answers on a first launch,
+    /// the site of the configured country; an empty string before initialization.
+    package var siteID: String {
+        lock.lock()
+        defer { lock.unlock() }
+        return resolvedSiteID ?? configuration?.country.getSiteId() ?? ""
     }
 }
 
 private extension MercadoPagoSDK {
+    struct StartTasks {
+        let siteID: Task<String, Never>
+        let preconnect: Task<Void, Never>?
+        let analyticsMonitoring: Task<Void, Never>
+    }
+
+    /// - Returns: The configuration to start with, or `nil` before `initialize(_:)` or once started.
+    func configurationToStart() -> Configuration? {
+        lock.lock()
+        defer { lock.unlock() }
+
+        guard self.initialized, startTasks == nil else { return nil }
+        return configuration
+    }
+
+    /// Records `siteID` and attaches it to the analytics tracks.
+    func setSiteID(_ siteID: String?) {
+        guard let siteID, !siteID.isEmpty else { return }
+
+        lock.lock()
+        resolvedSiteID = siteID
+        lock.unlock()
+
+        self.dependencies.analytics.updateSiteID(siteID)
+    }
+
+    func updateAnalyticsSiteID() {
+        lock.lock()
+        let siteID = resolvedSiteID
+        lock.unlock()
+
+        guard let siteID else { return }
+        self.dependencies.analytics.updateSiteID(siteID)
+    }
+
     func verifyCanBeInitialized(_ configuration: Configuration) {
         assert(
             !self.isInitialized,
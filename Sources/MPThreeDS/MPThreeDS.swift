@@ -130,7 +130,9 @@ public class MPThreeDS: NSObject {
     /// - Returns: Array of ``MPThreeDSWarning`` objects containing security warning details.
     ///
     public func getWarnings() -> [MPThreeDSWarning] {
-        return threeDSSDK.getWarnings()
+        return MPMetrics.shared.measure("three_ds.warnings") {
+            threeDSSDK.getWarnings()
+        }
     }
     
     /// Requests 3D Secure authentication parameters for a specific payment method.
@@ -160,7 +162,19 @@ public class MPThreeDS: NSObject {
     public func requestParameters(
         paymentMethodId: String
     ) throws(MPThreeDSError) -> MPThreeDSParameters {
-        
+        try MPTracer.shared.span(
+            "three_ds.request_parameters",
+            attributes: ["payment_method_id": paymentMethodId]
+        ) { () throws(MPThreeDSError) in
+            try MPMetrics.shared.measure("three_ds.request_parameters") { () throws(MPThreeDSError) in
+                try self.makeParameters(paymentMethodId: paymentMethodId)
+            }
+        }
+    }
+
+    private func makeParameters(
+        paymentMethodId: String
+    ) throws(MPThreeDSError) -> MPThreeDSParameters {
         /// Gets the Directory Server from the selected Payment Method ID
         guard let directoryServer = MPThreeDSDirectoryServer(rawValue: paymentMethodId) else {
             throw .noDirectoryServerAvailable
@@ -259,6 +273,13 @@ public class MPThreeDS: NSObject {
             ))
         }
         
+        let span = MPTracer.shared.begin("three_ds.challenge")
+        let start = ProcessInfo.processInfo.systemUptime
+        defer {
+            MPMetrics.shared.record("three_ds.challenge", duration: ProcessInfo.processInfo.systemUptime - start)
+            MPTracer.shared.end(span)
+        }
+
         return await withCheckedContinuation { continuation in
             self.challengeContinuation = continuation
             
@@ -278,6 +299,8 @@ public class MPThreeDS: NSObject {
     /// - The Cardholder chooses to cancel the transaction.
     /// - The ACS recommends a challenge, but the Merchant overrides the recommendation and chooses to complete the transaction without a challenge
     public func close() throws {
-        try parameters?.transaction.close()
+        try MPMetrics.shared.measure("three_ds.close") {
+            try parameters?.transaction.close()
+        }
     }
 }
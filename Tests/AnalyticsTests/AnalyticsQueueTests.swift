@@ -0,0 +1,325 @@
+//
+//  AnalyticsQueueTests.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+@testable import MPAnalytics
+import XCTest
+
+// MARK: - Test Doubles
+
+actor UploaderSpy: AnalyticsUploading {
+    private(set) var bodies: [Data] = []
+    private var failuresLeft = 0
+    private var failureStatusCode = 503
+
+    func failNext(_ count: Int, statusCode: Int = 503) {
+        self.failuresLeft = count
+        self.failureStatusCode = statusCode
+    }
+
+    func upload(_ body: Data) async throws {
+        self.bodies.append(body)
+
+        if self.failuresLeft > 0 {
+            self.failuresLeft -= 1
+            throw AnalyticsUploadError.statusCode(self.failureStatusCode)
+        }
+    }
+
+    func trackCounts() -> [Int] {
+        self.bodies.map { body in
+            let object = try? JSONSerialization.jsonObject(with: body) as? [String: Any]
+            return (object?["tracks"] as? [Any])?.count ?? 0
+        }
+    }
+}
+
+actor UploadGateSpy: AnalyticsUploadGate {
+    private(set) var performed = 0
+    private var rejects = false
+
+    func reject() {
+        self.rejects = true
+    }
+
+    func perform(_ upload: () async throws -> Void) async throws {
+        self.performed += 1
+
+        guard !self.rejects else { throw CancellationError() }
+        try await upload()
+    }
+}
+
+/// Suspends the first upload until `resume()`.
+actor SuspendingUploaderSpy: AnalyticsUploading {
+    private(set) var bodies: [Data] = []
+    private var suspendedUpload: CheckedContinuation<Void, Never>?
+    private var suspensionWaiter: CheckedContinuation<Void, Never>?
+
+    func upload(_ body: Data) async throws {
+        self.bodies.append(body)
+        guard self.bodies.count == 1 else { return }
+
+        await withCheckedContinuation { continuation in
+            self.suspendedUpload = continuation
+            self.suspensionWaiter?.resume()
+            self.suspensionWaiter = nil
+        }
+    }
+
+    func waitUntilSuspended() async {
+        guard self.suspendedUpload == nil else { return }
+        await withCheckedContinuation { self.suspensionWaiter = $0 }
+    }
+
+    func resume() {
+        self.suspendedUpload?.resume()
+        self.suspendedUpload = nil
+    }
+
+    func trackIDs() -> [[String]] {
+        self.bodies.map { body in
+            let object = try? JSONSerialization.jsonObject(with: body) as? [String: Any]
+            let tracks = object?["tracks"] as? [[String: String]] ?? []
+            return tracks.compactMap { $0["id"] }
+        }
+    }
+}
+
+// MARK: - Setup SUT
+
+private extension AnalyticsQueueTests {
+    typealias SUT = (
+        sut: AnalyticsQueue,
+        uploader: UploaderSpy
+    )
+
+    func makeSUT(
+        fileURL: URL? = nil,
+        configuration: AnalyticsQueue.Configuration = .init(maximumBatchSize: 20, flushInterval: 60),
+        file _: StaticString = #filePath,
+        line _: UInt = #line
+    ) -> SUT {
+        let uploader = UploaderSpy()
+        let sut = AnalyticsQueue(
+            uploader: uploader,
+            store: AnalyticsEventStore(fileURL: fileURL),
+            configuration: configuration
+        )
+
+        return (sut, uploader)
+    }
+
+    func makeTrack(_ index: Int) -> Data {
+        Data(#"{"path":"/checkout/step","id":"\#(index)"}"#.utf8)
+    }
+
+    func makeFileURL() -> URL {
+        let directory = FileManager.default.temporaryDirectory
+            .appendingPathComponent(UUID().uuidString, isDirectory: true)
+        self.temporaryDirectories.append(directory)
+        return directory.appendingPathComponent("pending.jsonl")
+    }
+}
+
+final class AnalyticsQueueTests: XCTestCase {
+    private var temporaryDirectories: [URL] = []
+
+    override func tearDown() {
+        for directory in self.temporaryDirectories {
+            try? FileManager.default.removeItem(at: directory)
+        }
+        self.temporaryDirectories = []
+        super.tearDown()
+    }
+
+    func test_simulatedCheckout_shouldSendAllTracksInOneRequest() async {
+        // Given
+        let (sut, uploader) = self.makeSUT()
+        let checkoutTracks = 12
+
+        // When
+        for index in 0 ..< checkoutTracks {
+            await sut.enqueue(self.makeTrack(index))
+        }
+        await sut.flush()
+
+        // Then
+        let requests = await uploader.trackCounts()
+        XCTAssertEqual(requests, [checkoutTracks])
+    }
+
+    func test_enqueue_whenBatchIsFull_shouldFlushImmediately() async {
+        // Given
+        let (sut, uploader) = self.makeSUT(configuration: .init(maximumBatchSize: 3, flushInterval: 60))
+
+        // When
+        for index in 0 ..< 7 {
+            await sut.enqueue(self.makeTrack(index))
+        }
+
+        // Then
+        let requests = await uploader.trackCounts()
+        let pendingCount = await sut.pendingCount
+        XCTAssertEqual(requests, [3, 3])
+        XCTAssertEqual(pendingCount, 1)
+    }
+
+    func test_enqueue_whenIntervalElapses_shouldFlush() async throws {
+        // Given
+        let (sut, uploader) = self.makeSUT(configuration: .init(maximumBatchSize: 20, flushInterval: 0.1))
+
+        // When
+        await sut.enqueue(self.makeTrack(0))
+        try await Task.sleep(nanoseconds: 400_000_000)
+
+        // Then
+        let requests = await uploader.trackCounts()
+        XCTAssertEqual(requests, [1])
+    }
+
+    func test_flush_whenUploadFails_shouldKeepTracksAndRetry() async throws {
+        // Given
+        let configuration = AnalyticsQueue.Configuration(
+            maximumBatchSize: 20,
+            flushInterval: 60,
+            initialRetryDelay: 0.1
+        )
+        let (sut, uploader) = self.makeSUT(configuration: configuration)
+        await uploader.failNext(1)
+        await sut.enqueue(self.makeTrack(0))
+        await sut.enqueue(self.makeTrack(1))
+
+        // When
+        await sut.flush()
+        let pendingAfterFailure = await sut.pendingCount
+        try await Task.sleep(nanoseconds: 500_000_000)
+
+        // Then
+        let requests = await uploader.trackCounts()
+        let pendingAfterRetry = await sut.pendingCount
+        XCTAssertEqual(pendingAfterFailure, 2)
+        XCTAssertEqual(requests, [2, 2])
+        XCTAssertEqual(pendingAfterRetry, 0)
+    }
+
+    func test_flush_whenBatchIsRejected_shouldDropItAndUploadNextBatch() async {
+        // Given
+        let fileURL = self.makeFileURL()
+        let (sut, uploader) = self.makeSUT(
+            fileURL: fileURL,
+            configuration: .init(maximumBatchSize: 2, flushInterval: 60)
+        )
+        await uploader.failNext(1, statusCode: 400)
+
+        // When
+        await sut.enqueue(self.makeTrack(0))
+        await sut.enqueue(self.makeTrack(1))
+        await sut.enqueue(self.makeTrack(2))
+        await sut.flush()
+
+        // Then
+        let requests = await uploader.trackCounts()
+        let pendingCount = await sut.pendingCount
+        XCTAssertEqual(requests, [2, 1])
+        XCTAssertEqual(pendingCount, 0)
+        XCTAssertFalse(FileManager.default.fileExists(atPath: fileURL.path))
+    }
+
+    func test_flush_whenTrimmedDuringUpload_shouldKeepTracksNotUploaded() async {
+        // Given
+        let uploader = SuspendingUploaderSpy()
+        let sut = AnalyticsQueue(
+            uploader: uploader,
+            store: AnalyticsEventStore(fileURL: nil),
+            configuration: .init(maximumBatchSize: 20, flushInterval: 60, maximumPendingEvents: 3)
+        )
+        for index in 0 ..< 3 {
+            await sut.enqueue(self.makeTrack(index))
+        }
+
+        // When
+        let flush = Task { await sut.flush() }
+        await uploader.waitUntilSuspended()
+        await sut.enqueue(self.makeTrack(3))
+        await sut.enqueue(self.makeTrack(4))
+        await uploader.resume()
+        await flush.value
+
+        // Then
+        let uploaded = await uploader.trackIDs()
+        let pendingCount = await sut.pendingCount
+        XCTAssertEqual(uploaded, [["0", "1", "2"], ["3", "4"]])
+        XCTAssertEqual(pendingCount, 0)
+    }
+
+    func test_pendingTracks_shouldBeRestoredFromDisk() async {
+        // Given
+        let fileURL = self.makeFileURL()
+        let (firstQueue, firstUploader) = self.makeSUT(fileURL: fileURL)
+        await firstUploader.failNext(1)
+        await firstQueue.enqueue(self.makeTrack(0))
+        await firstQueue.enqueue(self.makeTrack(1))
+        await firstQueue.flush()
+
+        // When
+        let (sut, uploader) = self.makeSUT(fileURL: fileURL)
+        await sut.flush()
+
+        // Then
+        let requests = await uploader.trackCounts()
+        XCTAssertEqual(requests, [2])
+        XCTAssertFalse(FileManager.default.fileExists(atPath: fileURL.path))
+    }
+
+    func test_makeEnvelope_shouldSpliceTracksIntoArray() throws {
+        // Given
+        let tracks = [self.makeTrack(0), self.makeTrack(1)]
+
+        // When
+        let body = AnalyticsQueue.makeEnvelope(tracks)
+
+        // Then
+        let object = try XCTUnwrap(JSONSerialization.jsonObject(with: body) as? [String: Any])
+        let decoded = try XCTUnwrap(object["tracks"] as? [[String: String]])
+        XCTAssertEqual(decoded.map { $0["id"] }, ["0", "1"])
+    }
+
+    func test_flush_withUploadGate_shouldUploadThroughGate() async {
+        // Given
+        let (sut, uploader) = self.makeSUT()
+        let gate = UploadGateSpy()
+        await sut.setUploadGate(gate)
+
+        // When
+        await sut.enqueue(self.makeTrack(0))
+        await sut.flush()
+
+        // Then
+        let performed = await gate.performed
+        let requests = await uploader.trackCounts()
+        XCTAssertEqual(performed, 1)
+        XCTAssertEqual(requests, [1])
+    }
+
+    func test_flush_whenUploadGateRejects_shouldKeepTracks() async {
+        // Given
+        let (sut, uploader) = self.makeSUT()
+        let gate = UploadGateSpy()
+        await gate.reject()
+        await sut.setUploadGate(gate)
+
+        // When
+        await sut.enqueue(self.makeTrack(0))
+        await sut.flush()
+
+        // Then
+        let requests = await uploader.trackCounts()
+        let pendingCount = await sut.pendingCount
+        XCTAssertTrue(requests.isEmpty)
+        XCTAssertEqual(pendingCount, 1)
+    }
+}
@@ -20,13 +20,37 @@ private struct MockEventData: AnalyticsEventData {
     }
 }
 
+private final class CountingNetworkMonitor: @unchecked Sendable, NetworkMonitoring {
+    private let lock = NSLock()
+    private var calls = 0
+    var networkType = "wifi"
+
+    var callCount: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return calls
+    }
+
+    func getCurrentNetworkType() -> String {
+        lock.lock()
+        defer { lock.unlock() }
+        calls += 1
+        return networkType
+    }
+}
+
+private struct ManualPathObserver: NetworkPathObserving {
+    func start(onChange _: @escaping @Sendable () -> Void) {}
+}
+
 // MARK: - Setup SUT
 
 private extension AnalyticsTests {
     typealias SUT = MPAnalytics
 
     func makeSUT(file _: StaticString = #filePath, line _: UInt = #line) async -> SUT {
-        let sut = MPAnalytics()
+        let queue = AnalyticsQueue(uploader: UploaderSpy(), store: AnalyticsEventStore(fileURL: nil))
+        let sut = MPAnalytics(queue: queue)
         await sut.initialize(version: "1.0.0", siteID: "MLB")
 
         return sut
@@ -40,26 +64,20 @@ final class AnalyticsTests: XCTestCase {
         let sut = await self.makeSUT()
         let eventPath = "payment/credit_card"
 
-        await sut.trackEvent(eventPath)
-
-        let path = await sut.track.getPath()
-        let type = await sut.track.getType()
+        let event = sut.trackEvent(eventPath)
 
-        XCTAssertEqual(path, eventPath)
-        XCTAssertEqual(type, .event)
+        XCTAssertEqual(event.path, eventPath)
+        XCTAssertEqual(event.type, .event)
     }
 
     func test_trackView_ShouldSetCorrectPathAndType() async {
         let sut = await self.makeSUT()
         let viewPath = "checkout/review"
 
-        await sut.trackView(viewPath)
-
-        let path = await sut.track.getPath()
-        let type = await sut.track.getType()
+        let event = sut.trackView(viewPath)
 
-        XCTAssertEqual(path, viewPath)
-        XCTAssertEqual(type, .view)
+        XCTAssertEqual(event.path, viewPath)
+        XCTAssertEqual(event.type, .view)
     }
 
     // MARK: - Event Data Tests
@@ -72,9 +90,9 @@ final class AnalyticsTests: XCTestCase {
             deviceInfo: sut.buyerInfo.getDeviceInfo()
         )
 
-        await sut.setEventData(mockData)
+        let event = sut.trackEvent("payment/credit_card").setEventData(mockData)
 
-        guard let storedData = await sut.track.getEventData() as? MockEventData else {
+        guard let storedData = event.eventData as? MockEventData else {
             return XCTFail("Event Data is not stored")
         }
         XCTAssertEqual(storedData.value, "test-123")
@@ -93,31 +111,41 @@ final class AnalyticsTests: XCTestCase {
             deviceInfo: sut.buyerInfo.getDeviceInfo()
         )
 
-        await sut
+        let event = sut
             .trackEvent(eventPath)
             .setEventData(mockData)
+            .setError("error")
 
-        let path = await sut.track.getPath()
-        let type = await sut.track.getType()
-        let resultEventData = await sut.track.getEventData() as? MockEventData
-
-        XCTAssertEqual(path, eventPath)
-        XCTAssertEqual(type, .event)
-        XCTAssertEqual(resultEventData?.value, "test-123")
+        XCTAssertEqual(event.path, eventPath)
+        XCTAssertEqual(event.type, .event)
+        XCTAssertEqual((event.eventData as? MockEventData)?.value, "test-123")
+        XCTAssertEqual(event.error, "error")
     }
 
     func test_setError_ShouldStoreError() async {
         let sut = await self.makeSUT()
         let expectError = "Error in line 123"
 
-        await sut.setError(expectError)
+        let event = sut.trackEvent("payment/credit_card").setError(expectError)
 
-        guard let storedError = await sut.track.getError() else {
+        guard let storedError = event.error else {
             return XCTFail("Event Data is not stored")
         }
         XCTAssertEqual(storedError, expectError)
     }
 
+    func test_concurrentEvents_ShouldNotShareState() async {
+        let sut = await self.makeSUT()
+
+        let first = sut.trackEvent("first").setError("first_error")
+        let second = sut.trackView("second")
+
+        XCTAssertEqual(first.path, "first")
+        XCTAssertEqual(first.error, "first_error")
+        XCTAssertEqual(second.path, "second")
+        XCTAssertNil(second.error)
+    }
+
     // MARK: - Send Tests
 
     func test_send_ShouldNotCrash() async {
@@ -138,14 +166,79 @@ final class AnalyticsTests: XCTestCase {
     func test_sendWithoutEventData_ShouldNotCrash() async {
         let sut = await self.makeSUT()
 
-        await sut.send()
+        await sut.trackEvent("test/path").send()
     }
 
     func test_multipleSends_ShouldNotCrash() async {
         let sut = await self.makeSUT()
-        let eventPath = "test/path"
+        let event = sut.trackEvent("test/path")
+
+        await event.send()
+        await event.send()
+    }
+
+    // MARK: - Context Snapshot Tests
+
+    func test_initialize_ShouldBuildContextSnapshot() async {
+        let monitor = CountingNetworkMonitor()
+        let sut = MPAnalytics(
+            queue: AnalyticsQueue(uploader: UploaderSpy(), store: AnalyticsEventStore(fileURL: nil)),
+            buyerInfo: MPBuyerInfo(networkMonitor: monitor),
+            pathObserver: ManualPathObserver()
+        )
+
+        await sut.initialize(version: "1.0.0", siteID: "MLB")
+
+        XCTAssertEqual(sut.context?.version, "1.0.0")
+        XCTAssertEqual(sut.context?.siteID, "MLB")
+        XCTAssertEqual(sut.context?.connectivityType, "wifi")
+        XCTAssertEqual(monitor.callCount, 1)
+    }
+
+    func test_send_ShouldNotProbeNetworkPerEvent() async {
+        let monitor = CountingNetworkMonitor()
+        let uploader = UploaderSpy()
+        let queue = AnalyticsQueue(uploader: uploader, store: AnalyticsEventStore(fileURL: nil))
+        let sut = MPAnalytics(queue: queue, buyerInfo: MPBuyerInfo(networkMonitor: monitor), pathObserver: ManualPathObserver())
+        await sut.initialize(version: "1.0.0", siteID: "MLB")
+
+        for index in 0 ..< 5 {
+            await sut.trackEvent("event/\(index)").send()
+        }
+        await queue.flush()
+
+        let requests = await uploader.trackCounts()
+        XCTAssertEqual(requests, [5])
+        XCTAssertEqual(monitor.callCount, 1)
+    }
+
+    func test_refreshConnectivity_ShouldUpdateSnapshot() async {
+        let monitor = CountingNetworkMonitor()
+        let sut = MPAnalytics(
+            queue: AnalyticsQueue(uploader: UploaderSpy(), store: AnalyticsEventStore(fileURL: nil)),
+            buyerInfo: MPBuyerInfo(networkMonitor: monitor),
+            pathObserver: ManualPathObserver()
+        )
+        await sut.initialize(version: "1.0.0", siteID: "MLB")
+
+        monitor.networkType = "4g"
+        sut.refreshConnectivity()
+
+        XCTAssertEqual(sut.context?.connectivityType, "4g")
+        XCTAssertEqual(sut.context?.siteID, "MLB")
+    }
+
+    func test_updateSiteID_ShouldUpdateSnapshot() async {
+        let sut = MPAnalytics(
+            queue: AnalyticsQueue(uploader: UploaderSpy(), store: AnalyticsEventStore(fileURL: nil)),
+            buyerInfo: MPBuyerInfo(networkMonitor: CountingNetworkMonitor()),
+            pathObserver: ManualPathObserver()
+        )
+        await sut.initialize(version: "1.0.0", siteID: "MLB")
+
+        sut.updateSiteID("MLA")
 
-        await sut.trackEvent(eventPath).send()
-        await sut.send()
+        XCTAssertEqual(sut.context?.siteID, "MLA")
+        XCTAssertEqual(sut.context?.connectivityType, "wifi")
     }
 }
@@ -5,9 +5,10 @@
 //  Created by Guilherme Prata Costa on 14/02/25.
 //
 
+import Foundation
 import MPAnalytics
 
-package final class MockAnalytics: AnalyticsInterface {
+package final class MockAnalytics: AnalyticsInterface, @unchecked Sendable {
     package actor Mock {
         package var sendCallback: (() -> Void)?
 
@@ -125,36 +126,44 @@ package final class MockAnalytics: AnalyticsInterface {
     package let sellerInfo = MPSellerInfo()
     package let buyerInfo = MPBuyerInfo()
 
-    package func initialize(version: String, siteID: String) async {
-        await self.mock.insert(.initialize(version: version, siteID: siteID))
-    }
+    private let lock = NSLock()
+    private var siteIDs: [String] = []
 
-    @discardableResult
-    package func trackView(_ path: String) async -> AnalyticsInterface {
-        await self.mock.insert(.trackView(path))
-        return self
+    /// Site IDs passed to `updateSiteID(_:)`, in order.
+    package var updatedSiteIDs: [String] {
+        lock.lock()
+        defer { lock.unlock() }
+        return siteIDs
     }
 
-    @discardableResult
-    package func trackEvent(_ path: String) async -> AnalyticsInterface {
-        await self.mock.insert(.track(path: path))
-        return self
+    package func updateSiteID(_ siteID: String) {
+        lock.lock()
+        siteIDs.append(siteID)
+        lock.unlock()
     }
 
-    @discardableResult
-    package func setEventData(_ data: AnalyticsEventData) async -> AnalyticsInterface {
-        await self.mock.insert(.setEventData(data.toDictionary()))
-        return self
+    package func initialize(version: String, siteID: String) async {
+        await self.mock.insert(.initialize(version: version, siteID: siteID))
     }
 
-    @discardableResult
-    package func setError(_ error: String) async -> AnalyticsInterface {
-        await self.mock.insert(.setError(error))
+    /// Records the event as the message sequence the builder produced:
+    /// track (or trackView), setError, setEventData and send.
+    package func send(_ event: AnalyticsEvent) async {
+        switch event.type {
+        case .event:
+            await self.mock.insert(.track(path: event.path))
+        case .view:
+            await self.mock.insert(.trackView(event.path))
+        }
 
-        return self
-    }
+        if let error = event.error {
+            await self.mock.insert(.setError(error))
+        }
+
+        if let eventData = event.eventData {
+            await self.mock.insert(.setEventData(eventData.toDictionary()))
+        }
 
-    package func send() async {
         await self.mock.insert(.send)
     }
 }
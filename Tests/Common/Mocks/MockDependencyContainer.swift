@@ -8,26 +8,32 @@ import MPAnalytics
 @testable import MPCore
 import XCTest
 
-package struct MockDependencyContainer: Sendable, HasNetwork, HasAnalytics, HasFingerPrint, HasNoDependency {
+package struct MockDependencyContainer: Sendable, HasNetwork, HasAnalytics, HasFingerPrint, HasSiteIDProvider, HasNoDependency {
     package let networkService: NetworkServiceProtocol
 
     package var analytics: AnalyticsInterface
 
     package let fingerPrint: FingerPrintProtocol
 
+    package let siteIDProvider: SiteIDProviderProtocol
+
     package let mockSession: MockURLSession
     package let mockAnalytics: MockAnalytics
+    package let mockSiteIDProvider: MockSiteIDProvider
 
     package init(
         session: MockURLSession = MockURLSession(),
         analytics: MockAnalytics = MockAnalytics(),
-        fingerPrint: MockFingerPrint = MockFingerPrint()
+        fingerPrint: MockFingerPrint = MockFingerPrint(),
+        siteIDProvider: MockSiteIDProvider = MockSiteIDProvider()
     ) {
         self.mockSession = session
         self.mockAnalytics = analytics
+        self.mockSiteIDProvider = siteIDProvider
 
         self.networkService = NetworkService(session: session)
         self.analytics = analytics
         self.fingerPrint = fingerPrint
+        self.siteIDProvider = siteIDProvider
     }
 }
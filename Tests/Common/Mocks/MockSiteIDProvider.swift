@@ -0,0 +1,46 @@
+//
+//  MockSiteIDProvider.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+import Foundation
+import MPCore
+
+package final class MockSiteIDProvider: SiteIDProviderProtocol, @unchecked Sendable {
+    private let lock = NSLock()
+    private var prefetches = 0
+    private var starts = 0
+
+    package let siteID: String
+
+    package init(siteID: String = "") {
+        self.siteID = siteID
+    }
+
+    /// Times `prefetchSiteID()` was called.
+    package var prefetchCount: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return prefetches
+    }
+
+    /// Times `startIfNeeded()` was called.
+    package var startCount: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return starts
+    }
+
+    package func prefetchSiteID() async {
+        lock.lock()
+        prefetches += 1
+        lock.unlock()
+    }
+
+    package func startIfNeeded() {
+        lock.lock()
+        starts += 1
+        lock.unlock()
+    }
+}
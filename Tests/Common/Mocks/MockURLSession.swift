@@ -12,6 +12,14 @@ package final class MockURLSession: URLSessionProtocol {
         var data: Data?
         var response: URLResponse?
         var error: Error?
+        var delay: UInt64 = 0
+        var delays: [UInt64] = []
+        var responses: [URLResponse] = []
+        package private(set) var requests: [URLRequest] = []
+
+        package func record(_ request: URLRequest) {
+            self.requests.append(request)
+        }
 
         package func setData(_ data: Data) {
             self.data = data
@@ -21,21 +29,58 @@ package final class MockURLSession: URLSessionProtocol {
             self.response = response
         }
 
-        package func setError(_ error: Error) {
+        package func setError(_ error: Error?) {
             self.error = error
         }
+
+        package func setDelay(nanoseconds: UInt64) {
+            self.delay = nanoseconds
+        }
+
+        /// Delays of the next requests, in order. Once consumed, `delay` applies again.
+        package func setDelays(nanoseconds: [UInt64]) {
+            self.delays = nanoseconds
+        }
+
+        /// Responses of the next requests, in order. Once consumed, `response` applies again.
+        package func setResponses(_ responses: [URLResponse]) {
+            self.responses = responses
+        }
+
+        func nextDelay() -> UInt64 {
+            self.delays.isEmpty ? self.delay : self.delays.removeFirst()
+        }
+
+        func nextResponse() -> URLResponse? {
+            self.responses.isEmpty ? self.response : self.responses.removeFirst()
+        }
     }
 
-    package init() {}
+    package init(reportsTaskMetrics: Bool = false) {
+        self.reportsTaskMetrics = reportsTaskMetrics
+    }
 
     package let mock = Mock()
 
-    package func data(for request: URLRequest) async throws -> (Data, URLResponse) {
+    /// Whether the service defers recording until task metrics arrive; the mock never reports them.
+    package let reportsTaskMetrics: Bool
+
+    package func data(
+        for request: URLRequest,
+        delegate _: (any URLSessionTaskDelegate)?
+    ) async throws -> (Data, URLResponse) {
+        await mock.record(request)
+
+        let delay = await mock.nextDelay()
+        if delay > 0 {
+            try await Task.sleep(nanoseconds: delay)
+        }
+
         if let error = await mock.error {
             throw error
         }
 
-        if let data = await mock.data, let response = await mock.response {
+        if let data = await mock.data, let response = await mock.nextResponse() {
             return (data, response)
         }
 
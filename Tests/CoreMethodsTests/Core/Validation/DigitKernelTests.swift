@@ -0,0 +1,100 @@
+//
+//  DigitKernelTests.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+@testable import CoreMethods
+import MPCore
+import XCTest
+
+private struct FixedClock: YearMonthClock {
+    let current: YearMonth
+}
+
+final class DigitKernelTests: XCTestCase {
+    func test_scan_withMaskedValidCard_shouldCountDigitsAndPassLuhn() {
+        // When
+        let scan = DigitKernel.scan("4509 9535 6623 3704")
+
+        // Then
+        XCTAssertEqual(scan.count, 16)
+        XCTAssertTrue(scan.passesLuhn)
+    }
+
+    func test_scan_withWrongCheckDigit_shouldFailLuhn() {
+        // When
+        let scan = DigitKernel.scan("4509953566233705")
+
+        // Then
+        XCTAssertEqual(scan.count, 16)
+        XCTAssertFalse(scan.passesLuhn)
+    }
+
+    func test_scan_withEmptyInput_shouldFailLuhn() {
+        XCTAssertEqual(DigitKernel.scan(""), DigitKernel.Scan())
+        XCTAssertFalse(DigitKernel.scan(" ").passesLuhn)
+    }
+
+    func test_digitCount_shouldIgnoreSeparators() {
+        XCTAssertEqual(DigitKernel.digitCount("1 2-3"), 3)
+    }
+
+    func test_parseNumber_shouldRejectNonDigitsAndEmptyInput() {
+        XCTAssertEqual(DigitKernel.parseNumber("0042".utf8)?.value, 42)
+        XCTAssertEqual(DigitKernel.parseNumber("0042".utf8)?.digits, 4)
+        XCTAssertNil(DigitKernel.parseNumber("4a".utf8))
+        XCTAssertNil(DigitKernel.parseNumber("".utf8))
+    }
+
+    func test_cardNumberValidation_withBrandWithoutLuhn_shouldSkipCheckDigit() {
+        // Given
+        let sut = CardNumberValidation(maxLength: 19)
+        let cardInfo = PaymentMethod.CardInfo(
+            bin: 589562,
+            length: .init(min: 16, max: 16),
+            validation: "none",
+            securityCode: .init(mode: "mandatory", location: "back", length: 3)
+        )
+
+        // When
+        sut.apply(cardInfo)
+
+        // Then
+        XCTAssertTrue(sut.isValid("5895 6200 0000 0001"))
+        XCTAssertFalse(sut.isValid("5895 6200 0000 00011"))
+        XCTAssertEqual(sut.error, .invalidLength)
+    }
+
+    func test_expirationDateParse_shouldAcceptTwoAndFourDigitYears() {
+        XCTAssertEqual(ExpirationDateValidation.parse("03/29")?.year, 2029)
+        XCTAssertEqual(ExpirationDateValidation.parse("03/2029")?.month, 3)
+        XCTAssertNil(ExpirationDateValidation.parse("03/29/1"))
+        XCTAssertNil(ExpirationDateValidation.parse("0329"))
+        XCTAssertNil(ExpirationDateValidation.parse("03/"))
+    }
+
+    func test_expirationDateValidation_shouldCompareAgainstClock() {
+        // Given
+        let sut = ExpirationDateValidation(clock: FixedClock(current: YearMonth(year: 2026, month: 10)))
+
+        // Then
+        XCTAssertTrue(sut.isValid("10/26"))
+        XCTAssertTrue(sut.isValid("01/2027"))
+        XCTAssertFalse(sut.isValid("09/26"))
+        XCTAssertEqual(sut.error, .expired)
+        XCTAssertFalse(sut.isValid("13/27"))
+        XCTAssertEqual(sut.error, .invalidDate)
+    }
+
+    func test_cardNumberValidation_performance() {
+        let sut = CardNumberValidation(maxLength: 19)
+
+        measure(metrics: [XCTClockMetric(), XCTMemoryMetric()]) {
+            for _ in 0 ..< 10000 {
+                _ = sut.isValid("4509 9535 6623 3704")
+            }
+        }
+    }
+}
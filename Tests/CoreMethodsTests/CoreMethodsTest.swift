@@ -180,12 +180,21 @@ final class CoreMethodsTests: XCTestCase {
 
     // MARK: - Setup SUT
 
-    private func makeSUT(file _: StaticString = #filePath, line _: UInt = #line) -> SUT {
-        let container = MockDependencyContainer()
+    private func makeSUT(
+        container: MockDependencyContainer = MockDependencyContainer(),
+        revalidator: CatalogRevalidator = CatalogRevalidator(),
+        file _: StaticString = #filePath,
+        line _: UInt = #line
+    ) -> SUT {
         let session = container.mockSession
         let analytics = container.mockAnalytics
 
-        let repository = CoreMethodsRepository(dependencies: container)
+        let repository = CoreMethodsRepository(
+            dependencies: container,
+            binCache: BinMetadataCache(directory: nil),
+            catalogCache: CatalogMemoryCache(),
+            revalidator: revalidator
+        )
 
         let generateTokenUseCase = GenerateCardTokenUseCase(dependencies: container, repository: repository)
         let identificationTypeUseCase = IdentificationTypesUseCase(repository: repository)
@@ -199,7 +208,8 @@ final class CoreMethodsTests: XCTestCase {
             identificationTypeUseCase: identificationTypeUseCase,
             installmentsUseCase: installmentsUseCase,
             paymentMethodUseCase: paymentMethodUseCase,
-            issuerUseCase: issuerUseCase
+            issuerUseCase: issuerUseCase,
+            revalidator: revalidator
         )
 
         return (coreMethodsService, session, analytics)
@@ -780,6 +790,119 @@ final class CoreMethodsTests: XCTestCase {
         }
     }
 
+    func test_paymentMethods_withRepeatedBin_shouldServeFromCacheWithoutNetworkCall() async throws {
+        // Arrange
+        let (sut, session, _) = self.makeSUT()
+
+        await session.mock.setResponse(self.makeHTTPResponse(statusCode: 200))
+        await session.mock.setData(PaymentMethodStub.validResponse)
+
+        // Act
+        let first = try await sut.paymentMethods(bin: "50243212")
+        let second = try await sut.paymentMethods(bin: "50243212")
+        let requests = await session.mock.requests
+
+        // Assert
+        XCTAssertEqual(first.map(\.id), second.map(\.id))
+        XCTAssertEqual(requests.count, 1)
+    }
+
+    func test_prefetch_withSixDigitBin_shouldServeEightDigitPaymentMethodsFromCache() async throws {
+        // Arrange
+        let (sut, session, analytics) = self.makeSUT()
+
+        await session.mock.setResponse(self.makeHTTPResponse(statusCode: 200))
+        await session.mock.setData(PaymentMethodStub.validResponse)
+
+        // Act
+        await sut.prefetch(bin: "502432")
+        let requestsAfterPrefetch = await session.mock.requests.count
+        let result = try await sut.paymentMethods(bin: "50243212")
+        let requestsAfterCall = await session.mock.requests.count
+        let prefetchedPaths = await session.mock.requests.compactMap { $0.url?.path }
+
+        // Assert
+        XCTAssertEqual(result.map(\.id), PaymentMethodStub.expectedResponse.map(\.id))
+        XCTAssertEqual(requestsAfterCall, requestsAfterPrefetch)
+        XCTAssertTrue(prefetchedPaths.contains { $0.contains("payment_methods") })
+        XCTAssertTrue(prefetchedPaths.contains { $0.contains("identification_types") })
+        let messages = await analytics.mock.getMessages()
+        XCTAssertFalse(messages.contains(.track(path: "/checkout_api_native/core_methods/identification_types/error")))
+    }
+
+    func test_catalogUpdates_shouldStreamUpdatesOfInjectedRevalidator() async {
+        // Arrange
+        let revalidator = CatalogRevalidator()
+        let (sut, _, _) = self.makeSUT(revalidator: revalidator)
+        let updates = sut.catalogUpdates()
+
+        // Act
+        revalidator.revalidate("identification_types") { .identificationTypes([]) }
+        var iterator = updates.makeAsyncIterator()
+        let update = await iterator.next()
+
+        // Assert
+        guard case .identificationTypes = update else {
+            return XCTFail("Expected an identification types update, got \(String(describing: update))")
+        }
+    }
+
+    func test_prefetch_shouldPrefetchSiteIDThroughInjectedProvider() async {
+        // Arrange
+        let container = MockDependencyContainer()
+        let (sut, session, _) = self.makeSUT(container: container)
+
+        await session.mock.setResponse(self.makeHTTPResponse(statusCode: 200))
+        await session.mock.setData(IdentificationTypeStub.validResponse)
+
+        // Act
+        await sut.prefetch()
+
+        // Assert
+        XCTAssertEqual(container.mockSiteIDProvider.prefetchCount, 1)
+    }
+
+    func test_identificationTypes_shouldStartDeferredSubsystemsThroughInjectedProvider() async throws {
+        // Arrange
+        let container = MockDependencyContainer()
+        let (sut, session, _) = self.makeSUT(container: container)
+
+        await session.mock.setResponse(self.makeHTTPResponse(statusCode: 200))
+        await session.mock.setData(IdentificationTypeStub.validResponse)
+
+        // Act
+        _ = try await sut.identificationTypes()
+
+        // Assert
+        XCTAssertEqual(container.mockSiteIDProvider.startCount, 1)
+    }
+
+    func test_issuers_withAmbiguousSixDigitEntry_shouldFetchEightDigitBin() async throws {
+        // Arrange
+        let (sut, session, _) = self.makeSUT()
+        let twoIssuers = """
+        [
+            { "id": "0", "name": "Banco", "merchant_account_id": "", "processing_mode": "aggregator",
+              "status": "active", "thumbnail": "" },
+            { "id": "1", "name": "Otro", "merchant_account_id": "", "processing_mode": "aggregator",
+              "status": "active", "thumbnail": "" }
+        ]
+        """
+
+        await session.mock.setResponse(self.makeHTTPResponse(statusCode: 200))
+        await session.mock.setData(Data(twoIssuers.utf8))
+
+        // Act
+        _ = try await sut.issuers(bin: "502432", paymentMethodID: "12345")
+        await session.mock.setData(IssuerStub.validResponse)
+        let result = try await sut.issuers(bin: "50243212", paymentMethodID: "12345")
+        let requests = await session.mock.requests
+
+        // Assert
+        XCTAssertEqual(result.map(\.id), ["0"])
+        XCTAssertEqual(requests.count, 2)
+    }
+
     func test_issuer_whenNetworkReturnsSuccess_shouldReturnInstallment() async {
         // Arrange
         let (sut, session, analytics) = self.makeSUT()
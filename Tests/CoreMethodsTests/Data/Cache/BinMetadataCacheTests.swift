@@ -0,0 +1,110 @@
+//
+//  BinMetadataCacheTests.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+@testable import CoreMethods
+import XCTest
+
+private extension BinMetadataCacheTests {
+    typealias SUT = (
+        sut: BinMetadataCache,
+        directory: URL
+    )
+
+    func makeSUT(
+        capacity: Int = 8,
+        timeToLive: TimeInterval = 60,
+        file _: StaticString = #filePath,
+        line _: UInt = #line
+    ) -> SUT {
+        let directory = FileManager.default.temporaryDirectory
+            .appendingPathComponent("BinMetadataCacheTests-\(UUID().uuidString)", isDirectory: true)
+        let sut = BinMetadataCache(directory: directory, capacity: capacity, timeToLive: timeToLive)
+
+        addTeardownBlock {
+            try? FileManager.default.removeItem(at: directory)
+        }
+
+        return (sut, directory)
+    }
+
+    func makeKey(bin: String = "45089010", mode: String = "aggregator") -> BinMetadataCache.Key {
+        BinMetadataCache.Key(resource: .paymentMethods, bin: bin, processingMode: mode, siteID: "MLB")
+    }
+
+    func decodeStrings(_ data: Data) throws -> [String] {
+        try JSONDecoder().decode([String].self, from: data)
+    }
+}
+
+final class BinMetadataCacheTests: XCTestCase {
+    func test_entry_afterInsert_shouldReturnValueFromMemory() {
+        let (sut, _) = self.makeSUT()
+        let key = self.makeKey()
+
+        sut.insert(["visa"], body: Data(#"["visa"]"#.utf8), etag: "\"v1\"", for: key)
+        let entry = sut.entry(for: key, decode: self.decodeStrings)
+
+        XCTAssertEqual(entry?.value, ["visa"])
+        XCTAssertEqual(entry?.etag, "\"v1\"")
+        XCTAssertTrue(entry?.isFresh(ttl: sut.timeToLive) ?? false)
+    }
+
+    func test_entry_withNewInstanceOnSameDirectory_shouldLoadFromDisk() {
+        let (sut, directory) = self.makeSUT()
+        let key = self.makeKey()
+
+        sut.insert(["master"], body: Data(#"["master"]"#.utf8), etag: "\"v2\"", for: key)
+        sut.flush()
+
+        let reloaded = BinMetadataCache(directory: directory)
+        let entry = reloaded.entry(for: key, decode: self.decodeStrings)
+
+        XCTAssertEqual(entry?.value, ["master"])
+        XCTAssertEqual(entry?.etag, "\"v2\"")
+    }
+
+    func test_key_shouldUseEightDigitBinPrefixAndSeparateProcessingModes() {
+        let (sut, _) = self.makeSUT()
+
+        sut.insert(["visa"], body: Data(#"["visa"]"#.utf8), etag: nil, for: self.makeKey(bin: "4508901012345678"))
+
+        XCTAssertNotNil(sut.entry(for: self.makeKey(bin: "45089010"), decode: self.decodeStrings))
+        XCTAssertNil(sut.entry(for: self.makeKey(bin: "45089010", mode: "gateway"), decode: self.decodeStrings))
+    }
+
+    func test_entry_olderThanTimeToLive_shouldBeStaleAndRevalidateShouldRefreshIt() {
+        let (sut, _) = self.makeSUT(timeToLive: 60)
+        let key = self.makeKey()
+        let past = Date().addingTimeInterval(-120)
+
+        sut.insert(["visa"], body: Data(#"["visa"]"#.utf8), etag: "\"v1\"", for: key, now: past)
+        let stale = sut.entry(for: key, decode: self.decodeStrings)
+
+        XCTAssertFalse(stale?.isFresh(ttl: sut.timeToLive) ?? true)
+
+        let refreshed = stale.map { sut.revalidate($0, for: key) }
+
+        XCTAssertTrue(refreshed?.isFresh(ttl: sut.timeToLive) ?? false)
+        XCTAssertEqual(refreshed?.etag, "\"v1\"")
+    }
+
+    func test_memoryTier_whenCapacityExceeded_shouldEvictLeastRecentlyUsed() {
+        let sut = BinMetadataCache(directory: nil, capacity: 2)
+        let first = self.makeKey(bin: "11111111")
+        let second = self.makeKey(bin: "22222222")
+        let third = self.makeKey(bin: "33333333")
+
+        sut.insert(["a"], body: Data(), etag: nil, for: first)
+        sut.insert(["b"], body: Data(), etag: nil, for: second)
+        _ = sut.entry(for: first, decode: self.decodeStrings)
+        sut.insert(["c"], body: Data(), etag: nil, for: third)
+
+        XCTAssertNotNil(sut.entry(for: first, decode: self.decodeStrings))
+        XCTAssertNil(sut.entry(for: second, decode: self.decodeStrings))
+        XCTAssertNotNil(sut.entry(for: third, decode: self.decodeStrings))
+    }
+}
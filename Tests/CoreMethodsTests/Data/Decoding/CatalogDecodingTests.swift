@@ -0,0 +1,72 @@
+//
+//  CatalogDecodingTests.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+@testable import CoreMethods
+import XCTest
+
+// MARK: - Fixtures
+
+private extension CatalogDecodingTests {
+    /// Installments response of a multi-issuer BIN: `issuers` entries with 24 payer costs each.
+    func makeLargeInstallmentsFixture(issuers: Int = 40) -> Data {
+        let payerCosts = (1 ... 24).map { installments in
+            """
+            {"installments":\(installments),"installment_amount":\(1000.0 / Double(installments)),\
+            "installment_rate":1.5,"installment_rate_collector":["MERCADOPAGO"],"total_amount":1015.0,\
+            "min_allowed_amount":2,"max_allowed_amount":60000,"discount_rate":0,"reimbursement_rate":0,\
+            "labels":["CFT_0,00%|TEA_0,00%","recommended_installment"],"payment_method_option_id":"option_\(installments)"}
+            """
+        }.joined(separator: ",")
+
+        let elements = (0 ..< issuers).map { index in
+            """
+            {"payment_method_id":"visa","payment_type_id":"credit_card","thumbnail":"https://example.com/visa.gif",\
+            "issuer":{"id":"\(index)","thumbnail":"https://example.com/issuer.gif"},"processing_mode":"aggregator",\
+            "merchant_account_id":"","payer_costs":[\(payerCosts)],\
+            "agreements":[{"merchant_accounts":[{"id":"account_\(index)","payment_method_option_id":"option"}],\
+            "time_frame":{"start_date":"2025-01-01T00:00:00.000-0300","end_date":"2026-01-01T00:00:00.000-0300"}}]}
+            """
+        }.joined(separator: ",")
+
+        return Data("[\(elements)]".utf8)
+    }
+}
+
+final class CatalogDecodingTests: XCTestCase {
+    func test_decodeInstallments_withLargeFixture_shouldDecodeEveryPayerCost() throws {
+        // Given
+        let data = self.makeLargeInstallmentsFixture()
+
+        // When
+        let result = try JSONDecoder().decode(DecodedModelList<DecodedInstallment>.self, from: data).models
+
+        // Then
+        XCTAssertEqual(result.count, 40)
+        XCTAssertEqual(result.map(\.payerCosts.count), Array(repeating: 24, count: 40))
+        XCTAssertEqual(result.last?.issuer.id, "39")
+        XCTAssertEqual(result.first?.payerCosts.last?.id, 24)
+        XCTAssertEqual(result.first?.agreements.first?.merchantAccounts.first?.id, "account_0")
+    }
+
+    func test_decodeInstallments_withMissingField_shouldThrowDecodingError() {
+        // Given
+        let data = Data(#"[{"payment_method_id":"visa"}]"#.utf8)
+
+        // When / Then
+        XCTAssertThrowsError(try JSONDecoder().decode(DecodedModelList<DecodedInstallment>.self, from: data)) { error in
+            XCTAssertTrue(error is DecodingError)
+        }
+    }
+
+    func test_decodeInstallments_performance() {
+        let data = self.makeLargeInstallmentsFixture()
+
+        measure(metrics: [XCTClockMetric(), XCTMemoryMetric()]) {
+            _ = try? JSONDecoder().decode(DecodedModelList<DecodedInstallment>.self, from: data)
+        }
+    }
+}
@@ -0,0 +1,129 @@
+//
+//  CardTokenBodyTests.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+@testable import CoreMethods
+import XCTest
+
+final class CardTokenBodyTests: XCTestCase {
+    func test_toJSONData_shouldMatchDictionaryEncoding() throws {
+        // Given
+        let sut = self.makeBody(device: self.makeDevice())
+
+        // When
+        let body = try XCTUnwrap(sut.toJSONData())
+
+        // Then
+        let written = try XCTUnwrap(JSONSerialization.jsonObject(with: body) as? NSDictionary)
+        let expected = try XCTUnwrap(JSONSerialization.jsonObject(with: XCTUnwrap(self.dictionaryJSONData(sut))) as? NSDictionary)
+        XCTAssertEqual(written, expected)
+    }
+
+    func test_toJSONData_withoutOptionalValues_shouldWriteNulls() throws {
+        // Given
+        let sut = CardTokenBody(cardNumber: nil, expirationMonth: nil, expirationYear: nil, securityCode: "123")
+
+        // When
+        let body = try XCTUnwrap(sut.toJSONData())
+
+        // Then
+        let object = try XCTUnwrap(JSONSerialization.jsonObject(with: body) as? [String: Any])
+        XCTAssertTrue(object["card_number"] is NSNull)
+        XCTAssertTrue(object["expiration_month"] is NSNull)
+        XCTAssertEqual(object["security_code"] as? String, "123")
+        XCTAssertNil(object["cardholder"])
+        XCTAssertNil(object["device"])
+    }
+
+    // MARK: - Performance
+
+    func test_performance_toJSONData() {
+        let sut = self.makeBody(device: self.makeDevice())
+
+        measure(metrics: [XCTClockMetric(), XCTMemoryMetric()]) {
+            for _ in 0 ..< 2_000 {
+                _ = sut.toJSONData()
+            }
+        }
+    }
+
+    func test_performance_dictionaryJSONData() {
+        let sut = self.makeBody(device: self.makeDevice())
+
+        measure(metrics: [XCTClockMetric(), XCTMemoryMetric()]) {
+            for _ in 0 ..< 2_000 {
+                _ = self.dictionaryJSONData(sut)
+            }
+        }
+    }
+}
+
+// MARK: - Helpers
+
+private extension CardTokenBodyTests {
+    func makeBody(device: Data?) -> CardTokenBody {
+        CardTokenBody(
+            cardNumber: "5031433215406351",
+            expirationMonth: "11",
+            expirationYear: "2030",
+            securityCode: "123",
+            esc: nil,
+            requireEsc: true,
+            buyerIdentification: BuyerIdentification(name: "APRO", number: "12345678909", type: "CPF"),
+            device: device
+        )
+    }
+
+    /// Fingerprint shaped like `Device.getInfoAsJsonData()`, about 3 KB.
+    func makeDevice() -> Data {
+        var vendorSpecific: [String: Any] = [:]
+        for index in 0 ..< 60 {
+            vendorSpecific["property_\(index)"] = "value-\(index)-\(UUID().uuidString)"
+        }
+        let object: [String: Any] = [
+            "fingerprint": [
+                "os": "iOS",
+                "system_version": "17.4",
+                "ram": 6_442_450_944,
+                "disk_space": 127_989_493_760,
+                "model": "iPhone15,2",
+                "vendor_ids": [["name": "vendor_id", "value": UUID().uuidString]],
+                "vendor_specific_attributes": vendorSpecific
+            ]
+        ]
+        return (try? JSONSerialization.data(withJSONObject: object)) ?? Data()
+    }
+
+    /// `[String: Any]` encoding used before `JSONWriter`, kept as a baseline.
+    func dictionaryJSONData(_ body: CardTokenBody) -> Data? {
+        var jsonObject: [String: Any] = [
+            "card_number": body.cardNumber as Any,
+            "expiration_month": Double(body.expirationMonth ?? "") as Any,
+            "expiration_year": Double(body.expirationYear ?? "") as Any,
+            "security_code": body.securityCode,
+            "card_id": body.cardId as Any,
+            "esc": body.esc as Any,
+            "require_esc": body.requireEsc as Any
+        ]
+
+        if let buyerIdentification = body.buyerIdentification {
+            jsonObject["cardholder"] = [
+                "identification": [
+                    "number": buyerIdentification.number ?? "",
+                    "type": buyerIdentification.type ?? ""
+                ],
+                "name": buyerIdentification.name
+            ]
+        }
+
+        if let deviceData = body.device,
+           let deviceObject = try? JSONSerialization.jsonObject(with: deviceData, options: []) as? [String: Any] {
+            jsonObject["device"] = deviceObject
+        }
+
+        return try? JSONSerialization.data(withJSONObject: jsonObject, options: [])
+    }
+}
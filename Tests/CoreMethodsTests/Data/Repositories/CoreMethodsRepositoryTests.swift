@@ -0,0 +1,244 @@
+//
+//  CoreMethodsRepositoryTests.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+import CommonTests
+@testable import CoreMethods
+import MPCore
+import XCTest
+
+private extension CoreMethodsRepositoryTests {
+    typealias SUT = (
+        sut: CoreMethodsRepository,
+        session: MockURLSession,
+        binCache: BinMetadataCache,
+        catalogCache: CatalogMemoryCache,
+        revalidator: CatalogRevalidator
+    )
+
+    func makeSUT(
+        maximumStaleness: TimeInterval = 60 * 60,
+        file _: StaticString = #filePath,
+        line _: UInt = #line
+    ) -> SUT {
+        let container = MockDependencyContainer(siteIDProvider: MockSiteIDProvider(siteID: self.siteID))
+        let policy = CatalogRevalidator.StalenessPolicy(
+            identificationTypes: maximumStaleness,
+            paymentMethods: maximumStaleness,
+            issuers: maximumStaleness
+        )
+        let binCache = BinMetadataCache(directory: nil, timeToLive: 60)
+        let catalogCache = CatalogMemoryCache(identificationTypesTimeToLive: 60, policy: policy)
+        let revalidator = CatalogRevalidator(policy: policy)
+
+        let sut = CoreMethodsRepository(
+            dependencies: container,
+            binCache: binCache,
+            catalogCache: catalogCache,
+            revalidator: revalidator
+        )
+
+        return (sut, container.mockSession, binCache, catalogCache, revalidator)
+    }
+
+    var siteID: String {
+        "MLB"
+    }
+
+    var params: IssuersParams {
+        IssuersParams(bin: "45089010", paymentMethodID: "visa")
+    }
+
+    var issuerKey: BinMetadataCache.Key {
+        BinMetadataCache.Key(
+            resource: .issuers(paymentMethodID: "visa"),
+            bin: "45089010",
+            processingMode: "",
+            siteID: self.siteID
+        )
+    }
+
+    func makeIssuer(_ name: String) -> Issuer {
+        Issuer(
+            id: "1",
+            name: name,
+            merchantAccountId: "",
+            processingMode: "aggregator",
+            status: "active",
+            thumbnail: ""
+        )
+    }
+
+    func makeIssuersData(_ name: String) -> Data {
+        Data(#"""
+        [{"id":"1","name":"\#(name)","merchant_account_id":"","processing_mode":"aggregator","status":"active","thumbnail":""}]
+        """#.utf8)
+    }
+
+    func makeHTTPResponse(statusCode: Int = 200) -> HTTPURLResponse {
+        HTTPURLResponse(url: URL(string: "http://example.com")!, statusCode: statusCode, httpVersion: nil, headerFields: nil)!
+    }
+}
+
+final class CoreMethodsRepositoryTests: XCTestCase {
+    func test_getIssuers_whenStaleAndOffline_shouldReturnStaleValue() async throws {
+        // Given
+        let (sut, session, binCache, _, revalidator) = self.makeSUT()
+        binCache.insert(
+            [self.makeIssuer("Old Bank")],
+            body: self.makeIssuersData("Old Bank"),
+            etag: nil,
+            for: self.issuerKey,
+            now: Date().addingTimeInterval(-120)
+        )
+        await session.mock.setError(URLError(.notConnectedToInternet))
+
+        // When
+        let result = try await sut.getIssuers(params: self.params)
+        await revalidator.waitForRevalidations()
+
+        // Then
+        XCTAssertEqual(result.value.map(\.name), ["Old Bank"])
+        XCTAssertTrue(result.isStale)
+        XCTAssertGreaterThanOrEqual(result.age, 120)
+    }
+
+    func test_getIssuers_whenStale_shouldRefreshInBackgroundAndPublishUpdate() async throws {
+        // Given
+        let (sut, session, binCache, _, revalidator) = self.makeSUT()
+        binCache.insert(
+            [self.makeIssuer("Old Bank")],
+            body: self.makeIssuersData("Old Bank"),
+            etag: nil,
+            for: self.issuerKey,
+            now: Date().addingTimeInterval(-120)
+        )
+        await session.mock.setResponse(self.makeHTTPResponse())
+        await session.mock.setData(self.makeIssuersData("New Bank"))
+        let updates = revalidator.updates()
+
+        // When
+        let stale = try await sut.getIssuers(params: self.params)
+        var iterator = updates.makeAsyncIterator()
+        let update = await iterator.next()
+        let refreshed = try await sut.getIssuers(params: self.params)
+
+        // Then
+        XCTAssertEqual(stale.value.map(\.name), ["Old Bank"])
+        guard case let .issuers(bin, paymentMethodID, issuers) = update else {
+            return XCTFail("Expected an issuers update, got \(String(describing: update))")
+        }
+        XCTAssertEqual(bin, "45089010")
+        XCTAssertEqual(paymentMethodID, "visa")
+        XCTAssertEqual(issuers.map(\.name), ["New Bank"])
+        XCTAssertEqual(refreshed.value.map(\.name), ["New Bank"])
+        XCTAssertFalse(refreshed.isStale)
+    }
+
+    func test_getIssuers_whenStalerThanMaximum_shouldFetchBeforeReturning() async throws {
+        // Given
+        let (sut, session, binCache, _, _) = self.makeSUT(maximumStaleness: 30)
+        binCache.insert(
+            [self.makeIssuer("Old Bank")],
+            body: self.makeIssuersData("Old Bank"),
+            etag: nil,
+            for: self.issuerKey,
+            now: Date().addingTimeInterval(-120)
+        )
+        await session.mock.setError(URLError(.notConnectedToInternet))
+
+        // When / Then
+        do {
+            _ = try await sut.getIssuers(params: self.params)
+            XCTFail("Expected a network error")
+        } catch {
+            XCTAssertTrue(error is APIClientError)
+        }
+    }
+
+    func test_getIssuers_whenStalerThanMaximumAndCircuitOpen_shouldReturnStaleValue() async throws {
+        // Given
+        let (sut, session, binCache, _, _) = self.makeSUT(maximumStaleness: 30)
+        binCache.insert(
+            [self.makeIssuer("Old Bank")],
+            body: self.makeIssuersData("Old Bank"),
+            etag: nil,
+            for: self.issuerKey,
+            now: Date().addingTimeInterval(-120)
+        )
+        let breaker = try XCTUnwrap(sut.dependencies.networkService.circuitBreaker)
+        let policy = try XCTUnwrap(CoreMethodsEndpoint.getIssuers(params: self.params).circuitBreakerPolicy)
+        for _ in 0 ..< policy.minimumRequests {
+            try breaker.admit("card_issuers", policy: policy)
+            breaker.record(.failure, for: "card_issuers", policy: policy)
+        }
+
+        // When
+        let result = try await sut.getIssuers(params: self.params)
+
+        // Then
+        let requests = await session.mock.requests
+        XCTAssertEqual(result.value.map(\.name), ["Old Bank"])
+        XCTAssertTrue(result.isStale)
+        XCTAssertTrue(requests.isEmpty)
+    }
+
+    func test_getIdentificationTypes_whenStale_shouldReturnCachedValueAndRevalidateOnce() async throws {
+        // Given
+        let (sut, session, _, catalogCache, revalidator) = self.makeSUT()
+        let cached = IdentificationTypesResponse(id: "DNI", name: "DNI", type: "number", minLength: 7, maxLength: 8)
+        catalogCache.identificationTypes.insert(
+            [cached],
+            for: self.siteID,
+            now: Date().addingTimeInterval(-120)
+        )
+        await session.mock.setResponse(self.makeHTTPResponse())
+        await session.mock.setData(Data(#"[{"id":"CPF","name":"CPF","type":"number","min_length":11,"max_length":11}]"#.utf8))
+        await session.mock.setDelay(nanoseconds: 50_000_000)
+
+        // When
+        async let first = sut.getIdentificationTypes()
+        async let second = sut.getIdentificationTypes()
+        let results = try await [first, second]
+        await revalidator.waitForRevalidations()
+        let refreshed = try await sut.getIdentificationTypes()
+        let requests = await session.mock.requests.count
+
+        // Then
+        XCTAssertEqual(results.map(\.isStale), [true, true])
+        XCTAssertEqual(results.map { $0.value.map(\.id) }, [["DNI"], ["DNI"]])
+        XCTAssertEqual(refreshed.value.map(\.id), ["CPF"])
+        XCTAssertEqual(requests, 1)
+    }
+
+    func test_getIdentificationTypes_whenStaleAndUnchanged_shouldNotPublishUpdate() async throws {
+        // Given
+        let (sut, session, _, catalogCache, revalidator) = self.makeSUT()
+        let cached = IdentificationTypesResponse(id: "DNI", name: "DNI", type: "number", minLength: 7, maxLength: 8)
+        catalogCache.identificationTypes.insert(
+            [cached],
+            for: self.siteID,
+            now: Date().addingTimeInterval(-120)
+        )
+        await session.mock.setResponse(self.makeHTTPResponse())
+        await session.mock.setData(Data(#"[{"id":"DNI","name":"DNI","type":"number","min_length":7,"max_length":8}]"#.utf8))
+        let updates = revalidator.updates()
+
+        // When
+        _ = try await sut.getIdentificationTypes()
+        await revalidator.waitForRevalidations()
+        revalidator.revalidate("sentinel") { .identificationTypes([]) }
+        await revalidator.waitForRevalidations()
+        var iterator = updates.makeAsyncIterator()
+        let update = await iterator.next()
+
+        // Then
+        guard case let .identificationTypes(types) = update else {
+            return XCTFail("Expected the sentinel update, got \(String(describing: update))")
+        }
+        XCTAssertTrue(types.isEmpty)
+    }
+}
@@ -0,0 +1,58 @@
+//
+//  DigitBufferTests.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+@testable import CoreMethods
+import XCTest
+
+final class DigitBufferTests: XCTestCase {
+    func test_replace_whenTypingAtTheEnd_shouldKeepLuhnChecksumInSync() {
+        var sut = DigitBuffer()
+
+        for byte in "4509953566233704".utf8 {
+            sut.replace(sut.count ..< sut.count, with: [byte])
+            XCTAssertEqual(sut.scan, DigitKernel.scan(sut.digits))
+        }
+
+        XCTAssertTrue(sut.scan.passesLuhn)
+    }
+
+    func test_replace_whenDeletingFromTheEnd_shouldKeepLuhnChecksumInSync() {
+        var sut = DigitBuffer(text: "4509953566233704")
+
+        while !sut.isEmpty {
+            sut.replace(sut.count - 1 ..< sut.count, with: [])
+            XCTAssertEqual(sut.scan, DigitKernel.scan(sut.digits))
+        }
+
+        XCTAssertEqual(sut.scan, DigitKernel.Scan())
+    }
+
+    func test_replace_whenEditingInTheMiddle_shouldSpliceDigits() {
+        var sut = DigitBuffer(text: "12345678")
+
+        sut.replace(2 ..< 4, with: "9a0".utf8)
+
+        XCTAssertEqual(sut.digits, "12905678")
+        XCTAssertEqual(sut.scan, DigitKernel.scan("12905678"))
+    }
+
+    func test_render_shouldApplyMask() {
+        let sut = DigitBuffer(text: "123456")
+
+        let rendered = sut.render(.init(pattern: "## ##", separator: "/"))
+
+        XCTAssertEqual(rendered, "12/34")
+    }
+
+    func test_digitRange_shouldSkipSeparators() {
+        let rendered = "1234 5678"
+
+        XCTAssertEqual(DigitBuffer.digitRange(of: NSRange(location: 3, length: 3), in: rendered), 3 ..< 5)
+        XCTAssertEqual(DigitBuffer.digitRange(of: NSRange(location: 9, length: 0), in: rendered), 8 ..< 8)
+        XCTAssertNil(DigitBuffer.digitRange(of: NSRange(location: 10, length: 0), in: rendered))
+    }
+}
@@ -267,6 +267,28 @@ final class PCIFieldStateTests: XCTestCase {
         XCTAssertEqual(sut.textField.text, "12-34-56")
     }
 
+    func test_maskShorterThanMaxLength_shouldRejectDigitsPastTheMask() {
+        let configuration = PCIFieldState.Configuration(
+            maxLength: 6,
+            validation: MockCardValidation(),
+            mask: .init(pattern: "##-##", separator: "-")
+        )
+        let sut = PCIFieldState(configuration: configuration)
+
+        simulateTextInput("123456", sut: sut)
+
+        XCTAssertEqual(sut.getValue(), "1234")
+        XCTAssertEqual(sut.textField.text, "12-34")
+        XCTAssertEqual(sut.count, 4)
+
+        // "12-34": deletes "4"
+        let range = NSRange(location: 4, length: 1)
+        _ = sut.textField(sut.textField, shouldChangeCharactersIn: range, replacementString: "")
+
+        XCTAssertEqual(sut.getValue(), "123")
+        XCTAssertEqual(sut.textField.text, "12-3")
+    }
+
     // MARK: - Edge Cases Tests
 
     func test_input_shouldHandlePasteCorrectly() {
@@ -277,6 +299,43 @@ final class PCIFieldStateTests: XCTestCase {
 
         XCTAssertEqual(sut.getValue(), "1234567890")
     }
+
+    func test_input_shouldDeleteDigitInTheMiddle() {
+        let (sut, textField) = self.makeSUT()
+        simulateTextInput("12345678", sut: sut)
+
+        // "1234 5678": deletes "5"
+        let range = NSRange(location: 5, length: 1)
+        _ = sut.textField(textField, shouldChangeCharactersIn: range, replacementString: "")
+
+        XCTAssertEqual(sut.getValue(), "1234678")
+        XCTAssertEqual(textField.text, "1234 678")
+        XCTAssertEqual(sut.count, 7)
+    }
+
+    func test_input_shouldNotTriggerOnChangeWhenDeletingSeparator() {
+        let (sut, textField) = self.makeSUT()
+        simulateTextInput("12345", sut: sut)
+        var changes = 0
+        sut.onChange = { _ in changes += 1 }
+
+        let range = NSRange(location: 4, length: 1)
+        _ = sut.textField(textField, shouldChangeCharactersIn: range, replacementString: "")
+
+        XCTAssertEqual(changes, 0)
+        XCTAssertEqual(textField.text, "1234 5")
+    }
+
+    func test_input_shouldResynchronizeWhenTextIsSetExternally() {
+        let (sut, textField) = self.makeSUT()
+        simulateTextInput("1234", sut: sut)
+
+        textField.text = "9999 88"
+        simulateTextInput("7", sut: sut)
+
+        XCTAssertEqual(sut.getValue(), "9999887")
+        XCTAssertEqual(textField.text, "9999 887")
+    }
 }
 
 // MARK: - Helpers
@@ -52,6 +52,7 @@ final class MPApplePayTests: XCTestCase {
         XCTAssertEqual(receivedToken.bin, ApplePayTokenStub.validToken.bin)
         let callCount = await useCaseMock.createTokenCallCount
         XCTAssertEqual(callCount, 1)
+        XCTAssertEqual(dependencies.mockSiteIDProvider.startCount, 1)
 
         await fulfillment(of: [sendExpectation], timeout: 1.0)
 
@@ -0,0 +1,87 @@
+//
+//  FingerPrintTests.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+@testable import MPCore
+import XCTest
+
+final class FingerPrintTests: XCTestCase {
+    func test_validated_withJSONObject_shouldReturnData() {
+        // Given
+        let data = Data(#"{"vendor_ids":[{"name":"vendor_id","value":"A1"}]}"#.utf8)
+
+        // Then
+        XCTAssertEqual(FingerPrint.validated(data), data)
+    }
+
+    func test_validated_withMalformedOrNonObjectData_shouldReturnNil() {
+        XCTAssertNil(FingerPrint.validated(nil))
+        XCTAssertNil(FingerPrint.validated(Data()))
+        XCTAssertNil(FingerPrint.validated(Data(#"{"a":}"#.utf8)))
+        XCTAssertNil(FingerPrint.validated(Data(#"{"a":1}, {"b":2}"#.utf8)))
+        XCTAssertNil(FingerPrint.validated(Data("[1]".utf8)))
+    }
+
+    func test_validatedOnce_withSameFingerprint_shouldValidateOnce() {
+        // Given
+        let counter = ValidationCounter()
+        let sut = FingerPrint { data in
+            counter.increment()
+            return FingerPrint.validated(data)
+        }
+        let data = Data(#"{"vendor_ids":[{"name":"vendor_id","value":"A1"}]}"#.utf8)
+
+        // When
+        let first = sut.validatedOnce(data)
+        let second = sut.validatedOnce(Data(data))
+
+        // Then
+        XCTAssertEqual(first, data)
+        XCTAssertEqual(second, data)
+        XCTAssertEqual(counter.count, 1)
+    }
+
+    func test_validatedOnce_withChangedOrMalformedFingerprint_shouldValidateAgain() {
+        // Given
+        let counter = ValidationCounter()
+        let sut = FingerPrint { data in
+            counter.increment()
+            return FingerPrint.validated(data)
+        }
+        let malformed = Data(#"{"a":}"#.utf8)
+
+        // When
+        _ = sut.validatedOnce(Data(#"{"a":1}"#.utf8))
+        let changed = sut.validatedOnce(Data(#"{"a":2}"#.utf8))
+        let first = sut.validatedOnce(malformed)
+        let second = sut.validatedOnce(malformed)
+
+        // Then
+        XCTAssertEqual(changed, Data(#"{"a":2}"#.utf8))
+        XCTAssertNil(first)
+        XCTAssertNil(second)
+        XCTAssertEqual(counter.count, 4)
+    }
+}
+
+// MARK: - Helpers
+
+private final class ValidationCounter: @unchecked Sendable {
+    private let lock = NSLock()
+    private var value = 0
+
+    var count: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return value
+    }
+
+    func increment() {
+        lock.lock()
+        value += 1
+        lock.unlock()
+    }
+}
@@ -0,0 +1,153 @@
+//
+//  FixedDateParserTests.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+@testable import MPCore
+import XCTest
+
+private final class NowStub: @unchecked Sendable {
+    private let lock = NSLock()
+    private var storage: Date
+
+    init(_ date: Date) {
+        self.storage = date
+    }
+
+    var date: Date {
+        get {
+            lock.lock()
+            defer { lock.unlock() }
+            return storage
+        }
+        set {
+            lock.lock()
+            defer { lock.unlock() }
+            storage = newValue
+        }
+    }
+}
+
+private extension FixedDateParserTests {
+    typealias SUT = (sut: SystemYearMonthClock, now: NowStub)
+
+    func makeSUT(now date: Date, file _: StaticString = #filePath, line _: UInt = #line) -> SUT {
+        var calendar = Calendar(identifier: .gregorian)
+        calendar.timeZone = TimeZone(identifier: "UTC")!
+
+        let now = NowStub(date)
+        let sut = SystemYearMonthClock(calendar: calendar) { now.date }
+        return (sut, now)
+    }
+
+    func formatterDate(_ text: String) -> Date? {
+        let formatter = DateFormatter()
+        formatter.locale = Locale(identifier: "en_US_POSIX")
+        formatter.dateFormat = "yyyy-MM-dd'T'HH:mm:ss.SSSZ"
+        return formatter.date(from: text)
+    }
+}
+
+final class FixedDateParserTests: XCTestCase {
+    func test_iso8601_withOffset_shouldMatchDateFormatter() {
+        // Given
+        let values = [
+            "2025-03-07T00:00:00.000-0400",
+            "2024-02-29T23:59:59.999+0000",
+            "1999-12-31T12:30:15.250+0530",
+            "2100-01-01T00:00:00.000-1200"
+        ]
+
+        // Then
+        for value in values {
+            let parsed = FixedDateParser.date(iso8601: value)
+            let expected = formatterDate(value)
+            XCTAssertNotNil(parsed, value)
+            XCTAssertEqual(
+                parsed?.timeIntervalSince1970 ?? 0,
+                expected?.timeIntervalSince1970 ?? -1,
+                accuracy: 0.001,
+                value
+            )
+        }
+    }
+
+    func test_iso8601_withZuluColonOffsetAndNoFraction_shouldParse() {
+        // Given
+        let expected = Date(timeIntervalSince1970: 1_741_320_000)
+
+        // Then
+        XCTAssertEqual(FixedDateParser.date(iso8601: "2025-03-07T04:00:00Z"), expected)
+        XCTAssertEqual(FixedDateParser.date(iso8601: "2025-03-07T00:00:00-04:00"), expected)
+        XCTAssertEqual(FixedDateParser.date(iso8601: "2025-03-07T04:00:00.5Z"), expected + 0.5)
+    }
+
+    func test_iso8601_withInvalidValue_shouldReturnNil() {
+        XCTAssertNil(FixedDateParser.date(iso8601: ""))
+        XCTAssertNil(FixedDateParser.date(iso8601: "2025-03-07"))
+        XCTAssertNil(FixedDateParser.date(iso8601: "2025-13-07T00:00:00Z"))
+        XCTAssertNil(FixedDateParser.date(iso8601: "2025-02-29T00:00:00Z"))
+        XCTAssertNil(FixedDateParser.date(iso8601: "2025-03-07T24:00:00Z"))
+        XCTAssertNil(FixedDateParser.date(iso8601: "2025-03-07T00:00:00."))
+        XCTAssertNil(FixedDateParser.date(iso8601: "2025-03-07T00:00:00.000"))
+        XCTAssertNil(FixedDateParser.date(iso8601: "2025-03-07T00:00:00Z "))
+        XCTAssertNil(FixedDateParser.date(iso8601: "２025-03-07T00:00:00Z"))
+    }
+
+    func test_expiration_shouldParseTwoAndFourDigitYears() {
+        XCTAssertEqual(FixedDateParser.expiration("11/30", century: 2000), YearMonth(year: 2030, month: 11))
+        XCTAssertEqual(FixedDateParser.expiration("01/2031", century: 2000), YearMonth(year: 2031, month: 1))
+        XCTAssertEqual(FixedDateParser.expiration("01/05", century: 2100), YearMonth(year: 2105, month: 1))
+    }
+
+    func test_expiration_withInvalidValue_shouldReturnNil() {
+        XCTAssertNil(FixedDateParser.expiration("13/30", century: 2000))
+        XCTAssertNil(FixedDateParser.expiration("00/30", century: 2000))
+        XCTAssertNil(FixedDateParser.expiration("1/30", century: 2000))
+        XCTAssertNil(FixedDateParser.expiration("11/3", century: 2000))
+        XCTAssertNil(FixedDateParser.expiration("11/303", century: 2000))
+        XCTAssertNil(FixedDateParser.expiration("1130", century: 2000))
+        XCTAssertNil(FixedDateParser.expiration("11/3a", century: 2000))
+    }
+
+    func test_yearMonth_shouldOrderByYearThenMonth() {
+        XCTAssertLessThan(YearMonth(year: 2025, month: 12), YearMonth(year: 2026, month: 1))
+        XCTAssertLessThan(YearMonth(year: 2026, month: 1), YearMonth(year: 2026, month: 2))
+        XCTAssertEqual(YearMonth(year: 2026, month: 10).century, 2000)
+    }
+
+    func test_clock_shouldFollowNowAcrossMonths() {
+        // Given
+        let (sut, now) = makeSUT(now: Date(timeIntervalSince1970: 1_790_812_799)) // 2026-09-30T23:59:59Z
+
+        // When
+        let september = sut.current
+        let cached = sut.current
+        now.date = Date(timeIntervalSince1970: 1_790_812_800) // 2026-10-01T00:00:00Z
+        let october = sut.current
+        now.date = Date(timeIntervalSince1970: 1_790_812_799)
+        let back = sut.current
+
+        // Then
+        XCTAssertEqual(september, YearMonth(year: 2026, month: 9))
+        XCTAssertEqual(cached, september)
+        XCTAssertEqual(october, YearMonth(year: 2026, month: 10))
+        XCTAssertEqual(back, september)
+    }
+
+    func test_firstTwoDigitsOfYear_shouldUseYearOfClock() {
+        // Given
+        let (sut, now) = makeSUT(now: Date(timeIntervalSince1970: 1_790_812_800)) // 2026-10-01T00:00:00Z
+
+        // When
+        let current = sut.firstTwoDigitsOfYear
+        now.date = Date(timeIntervalSince1970: 4_102_444_800) // 2100-01-01T00:00:00Z
+        let nextCentury = sut.firstTwoDigitsOfYear
+
+        // Then
+        XCTAssertEqual(current, "20")
+        XCTAssertEqual(nextCentury, "21")
+    }
+}
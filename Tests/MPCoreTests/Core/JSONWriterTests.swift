@@ -0,0 +1,69 @@
+//
+//  JSONWriterTests.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+@testable import MPCore
+import XCTest
+
+final class JSONWriterTests: XCTestCase {
+    func test_object_shouldSeparateMembersAndNestedObjects() {
+        var sut = JSONWriter()
+
+        sut.beginObject()
+        sut.field("a", "x")
+        sut.key("nested")
+        sut.beginObject()
+        sut.field("b", 1.0)
+        sut.field("c", nil as Bool?)
+        sut.endObject()
+        sut.field("d", true)
+        sut.endObject()
+
+        XCTAssertEqual(String(decoding: sut.data, as: UTF8.self), #"{"a":"x","nested":{"b":1,"c":null},"d":true}"#)
+    }
+
+    func test_string_shouldEscapeQuotesBackslashesAndControlCharacters() throws {
+        var sut = JSONWriter()
+        let value = "a\"b\\c\nd\u{01}é😀"
+
+        sut.beginObject()
+        sut.field("v", value)
+        sut.endObject()
+
+        let object = try XCTUnwrap(JSONSerialization.jsonObject(with: sut.data) as? [String: String])
+        XCTAssertEqual(object["v"], value)
+        XCTAssertTrue(String(decoding: sut.data, as: UTF8.self).contains(#"\u0001"#))
+    }
+
+    func test_number_shouldWriteIntegersWithoutFractionAndNonFiniteAsNull() {
+        var sut = JSONWriter()
+
+        sut.beginObject()
+        sut.field("month", 12.0)
+        sut.field("rate", 1.5)
+        sut.field("invalid", Double.nan)
+        sut.endObject()
+
+        XCTAssertEqual(String(decoding: sut.data, as: UTF8.self), #"{"month":12,"rate":1.5,"invalid":null}"#)
+    }
+
+    func test_rawField_shouldSpliceObjectsVerbatimAndSkipOtherValues() {
+        var sut = JSONWriter()
+        let device = Data(#" {"fingerprint":{"os":"iOS"}} "#.utf8)
+
+        sut.beginObject()
+        sut.rawField("device", device)
+        sut.rawField("invalid", Data("[1]".utf8))
+        sut.rawField("missing", nil)
+        sut.field("after", "x")
+        sut.endObject()
+
+        XCTAssertEqual(
+            String(decoding: sut.data, as: UTF8.self),
+            #"{"device": {"fingerprint":{"os":"iOS"}} ,"after":"x"}"#
+        )
+    }
+}
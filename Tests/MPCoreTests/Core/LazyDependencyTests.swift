@@ -0,0 +1,81 @@
+//
+//  LazyDependencyTests.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+@testable import MPCore
+import XCTest
+
+private final class BuildCounter: @unchecked Sendable {
+    private let lock = NSLock()
+    private var storage = 0
+
+    var count: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return storage
+    }
+
+    func make() -> Int {
+        lock.lock()
+        defer { lock.unlock() }
+        storage += 1
+        return storage
+    }
+}
+
+private extension LazyDependencyTests {
+    typealias SUT = (sut: LazyDependency<Int>, counter: BuildCounter)
+
+    func makeSUT(file _: StaticString = #filePath, line _: UInt = #line) -> SUT {
+        let counter = BuildCounter()
+        let sut = LazyDependency { counter.make() }
+        return (sut, counter)
+    }
+}
+
+final class LazyDependencyTests: XCTestCase {
+    func test_init_shouldNotBuildValue() {
+        let (sut, counter) = self.makeSUT()
+
+        XCTAssertFalse(sut.isBuilt)
+        XCTAssertEqual(counter.count, 0)
+    }
+
+    func test_value_whenAccessedConcurrently_shouldBuildOnce() async {
+        // Given
+        let (sut, counter) = self.makeSUT()
+
+        // When
+        let values = await withTaskGroup(of: Int.self) { group in
+            for _ in 0 ..< 20 {
+                group.addTask { sut.value }
+            }
+            return await group.reduce(into: []) { $0.append($1) }
+        }
+
+        // Then
+        XCTAssertEqual(Set(values), [1])
+        XCTAssertEqual(counter.count, 1)
+        XCTAssertTrue(sut.isBuilt)
+    }
+
+    func test_container_shouldBuildServicesOnFirstAccess() {
+        // Given
+        let counter = BuildCounter()
+        let sut = CoreDependencyContainer(networkService: {
+            _ = counter.make()
+            return NetworkService()
+        }())
+
+        // When
+        XCTAssertEqual(counter.count, 0)
+        _ = sut.networkService
+        _ = sut.networkService
+
+        // Then
+        XCTAssertEqual(counter.count, 1)
+    }
+}
@@ -0,0 +1,158 @@
+//
+//  MPMetricsTests.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+@testable import MPCore
+import XCTest
+
+private actor ExporterSpy: MPMetricsExporter {
+    private(set) var snapshots: [MPMetrics.Snapshot] = []
+
+    func export(_ snapshot: MPMetrics.Snapshot) {
+        snapshots.append(snapshot)
+    }
+}
+
+private struct MetricsError: Error {}
+
+private extension MPMetricsTests {
+    typealias SUT = MPMetrics
+
+    func makeSUT(isEnabled: Bool = true, file _: StaticString = #filePath, line _: UInt = #line) -> SUT {
+        let sut = MPMetrics()
+        sut.isEnabled = isEnabled
+        return sut
+    }
+}
+
+final class MPMetricsTests: XCTestCase {
+    func test_instruments_whenDisabled_shouldNotRecord() {
+        // Given
+        let sut = self.makeSUT(isEnabled: false)
+
+        // When
+        sut.increment("calls")
+        sut.set("in_flight", to: 2)
+        let value = sut.measure("operation") { 42 }
+
+        // Then
+        let snapshot = sut.snapshot()
+        XCTAssertEqual(value, 42)
+        XCTAssertTrue(snapshot.counters.isEmpty)
+        XCTAssertTrue(snapshot.gauges.isEmpty)
+        XCTAssertTrue(snapshot.histograms.isEmpty)
+    }
+
+    func test_instruments_whenEnabled_shouldRecordCountersAndGauges() {
+        let sut = self.makeSUT()
+
+        sut.increment("calls")
+        sut.increment("calls", by: 2)
+        sut.adjust("in_flight", by: 3)
+        sut.adjust("in_flight", by: -1)
+
+        let snapshot = sut.snapshot()
+        XCTAssertEqual(snapshot.counters["calls"], 3)
+        XCTAssertEqual(snapshot.gauges["in_flight"], 2)
+    }
+
+    func test_adjust_belowZero_shouldClampAtZero() {
+        // Given
+        let sut = self.makeSUT()
+
+        // When
+        sut.adjust("in_flight", by: -1)
+
+        // Then
+        XCTAssertEqual(sut.snapshot().gauges["in_flight"], 0)
+    }
+
+    func test_measure_whenOperationThrows_shouldRecordDurationAndCountError() async {
+        // Given
+        let sut = self.makeSUT()
+
+        // When
+        _ = try? await sut.measure("core_methods.tokenization") { () async throws -> Int in
+            throw MetricsError()
+        }
+        _ = await sut.measure("core_methods.tokenization") { 1 }
+
+        // Then
+        let snapshot = sut.snapshot()
+        XCTAssertEqual(snapshot.histograms["core_methods.tokenization"]?.count, 2)
+        XCTAssertEqual(snapshot.counters["core_methods.tokenization.errors"], 1)
+    }
+
+    func test_snapshotAndReset_shouldCoverInstrumentsOfEveryShard() {
+        // Given
+        let sut = self.makeSUT()
+        let names = (0 ..< 64).map { "instrument.\($0)" }
+
+        // When
+        for name in names {
+            sut.increment(name)
+            sut.record(name, duration: 0.01)
+        }
+        let recorded = sut.snapshot()
+        sut.reset()
+
+        // Then
+        XCTAssertEqual(Set(recorded.counters.keys), Set(names))
+        XCTAssertEqual(Set(recorded.histograms.keys), Set(names))
+        XCTAssertTrue(sut.snapshot().counters.isEmpty)
+        XCTAssertTrue(sut.snapshot().histograms.isEmpty)
+    }
+
+    func test_histogram_shouldReportPercentilesWithinBucketPrecision() throws {
+        // Given
+        var sut = MPMetrics.Histogram()
+
+        // When
+        for millisecond in 1 ... 1000 {
+            sut.record(Double(millisecond) / 1000)
+        }
+
+        // Then
+        let p50 = try XCTUnwrap(sut.percentile(0.5))
+        let p99 = try XCTUnwrap(sut.percentile(0.99))
+        XCTAssertEqual(p50, 0.5, accuracy: 0.5 * 0.07)
+        XCTAssertEqual(p99, 0.99, accuracy: 0.99 * 0.07)
+        XCTAssertEqual(sut.percentile(1), 1)
+        XCTAssertEqual(sut.min, 0.001)
+        XCTAssertEqual(sut.max, 1)
+        XCTAssertEqual(sut.count, 1000)
+    }
+
+    func test_histogramBuckets_shouldBeContiguous() {
+        for value: UInt64 in 0 ..< 10_000 {
+            let bucket = MPMetrics.Histogram.bucket(of: value)
+            XCTAssertLessThan(value, MPMetrics.Histogram.upperBound(of: bucket))
+            if bucket > 0 {
+                XCTAssertGreaterThanOrEqual(value, MPMetrics.Histogram.upperBound(of: bucket - 1))
+            }
+        }
+        XCTAssertEqual(MPMetrics.Histogram.bucket(of: .max), MPMetrics.Histogram.bucketCount - 1)
+    }
+
+    func test_export_shouldSendSnapshotToEveryExporter() async {
+        // Given
+        let sut = self.makeSUT()
+        let first = ExporterSpy()
+        let second = ExporterSpy()
+        sut.addExporter(first)
+        sut.addExporter(second)
+        sut.increment("calls")
+
+        // When
+        await sut.export()
+
+        // Then
+        let firstSnapshots = await first.snapshots
+        let secondSnapshots = await second.snapshots
+        XCTAssertEqual(firstSnapshots.map(\.counters), [["calls": 1]])
+        XCTAssertEqual(secondSnapshots.map(\.counters), [["calls": 1]])
+    }
+}
@@ -0,0 +1,134 @@
+//
+//  MPTracerTests.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+@testable import MPCore
+import XCTest
+
+private struct TraceError: Error {}
+
+private extension MPTracerTests {
+    typealias SUT = MPTracer
+
+    func makeSUT(capacity: Int = 16, isEnabled: Bool = true, file _: StaticString = #filePath, line _: UInt = #line) -> SUT {
+        let sut = MPTracer(capacity: capacity)
+        sut.isEnabled = isEnabled
+        return sut
+    }
+
+    func decode(_ data: Data) throws -> [String: Any] {
+        try XCTUnwrap(JSONSerialization.jsonObject(with: data) as? [String: Any])
+    }
+}
+
+final class MPTracerTests: XCTestCase {
+    func test_span_whenDisabled_shouldNotRecord() async {
+        let sut = self.makeSUT(isEnabled: false)
+
+        let value = await sut.span("core_methods.issuers") { 42 }
+        sut.event("card_field.created")
+
+        XCTAssertEqual(value, 42)
+        XCTAssertTrue(sut.spans().isEmpty)
+    }
+
+    func test_span_shouldNestChildrenThroughTaskLocal() async throws {
+        // Given
+        let sut = self.makeSUT()
+
+        // When
+        await sut.span("core_methods.tokenization") {
+            await sut.span("core_methods.tokenization.fingerprint") {}
+            await withTaskGroup(of: Void.self) { group in
+                group.addTask { await sut.span("POST card_tokens") {} }
+            }
+        }
+
+        // Then
+        let spans = sut.spans()
+        let parent = try XCTUnwrap(spans.first { $0.name == "core_methods.tokenization" })
+        let children = spans.filter { $0.parentSpanID == parent.spanID }
+        XCTAssertNil(parent.parentSpanID)
+        XCTAssertEqual(Set(children.map(\.name)), ["core_methods.tokenization.fingerprint", "POST card_tokens"])
+        XCTAssertEqual(Set(spans.map(\.traceID)).count, 1)
+        XCTAssertEqual(parent.traceID.count, 32)
+        XCTAssertEqual(parent.spanID.count, 16)
+    }
+
+    func test_span_whenOperationThrows_shouldRecordErrorAndRethrow() {
+        let sut = self.makeSUT()
+
+        XCTAssertThrowsError(try sut.span("three_ds.request_parameters") { () throws(TraceError) in
+            throw TraceError()
+        })
+
+        XCTAssertEqual(sut.spans().map(\.isError), [true])
+    }
+
+    func test_startTrace_shouldGiveTopLevelSpansNewTraceID() async {
+        let sut = self.makeSUT()
+
+        await sut.span("first") {}
+        sut.startTrace()
+        await sut.span("second") {}
+
+        let traceIDs = sut.spans().map(\.traceID)
+        XCTAssertEqual(traceIDs.count, 2)
+        XCTAssertNotEqual(traceIDs.first, traceIDs.last)
+    }
+
+    func test_spans_whenBufferIsFull_shouldKeepLatestSpans() {
+        let sut = self.makeSUT(capacity: 3)
+
+        for index in 0 ..< 5 {
+            sut.event("event_\(index)")
+        }
+
+        XCTAssertEqual(sut.spans().map(\.name), ["event_2", "event_3", "event_4"])
+    }
+
+    func test_export_chromeTrace_shouldWriteCompleteAndInstantEvents() async throws {
+        // Given
+        let sut = self.makeSUT()
+        sut.event("card_field.first_keystroke")
+        await sut.span("GET payment_methods", attributes: ["priority": "interactive"]) {}
+
+        // When
+        let json = try self.decode(sut.export(.chromeTrace))
+
+        // Then
+        let events = try XCTUnwrap(json["traceEvents"] as? [[String: Any]])
+        XCTAssertEqual(events.map { $0["ph"] as? String }, ["i", "X"])
+        XCTAssertEqual(events.last?["name"] as? String, "GET payment_methods")
+        XCTAssertNotNil(events.last?["dur"] as? Double)
+        let args = try XCTUnwrap(events.last?["args"] as? [String: Any])
+        XCTAssertEqual(args["priority"] as? String, "interactive")
+    }
+
+    func test_export_otlpJSON_shouldWriteSpansWithParentAndStatus() async throws {
+        // Given
+        let sut = self.makeSUT()
+        _ = try? await sut.span("core_methods.issuers") { () async throws -> Void in
+            await sut.span("GET card_issuers") {}
+            throw TraceError()
+        }
+
+        // When
+        let json = try self.decode(sut.export(.otlpJSON))
+
+        // Then
+        let resourceSpans = try XCTUnwrap(json["resourceSpans"] as? [[String: Any]])
+        let scopeSpans = try XCTUnwrap(resourceSpans.first?["scopeSpans"] as? [[String: Any]])
+        let spans = try XCTUnwrap(scopeSpans.first?["spans"] as? [[String: Any]])
+        XCTAssertEqual(spans.count, 2)
+
+        let child = try XCTUnwrap(spans.first { $0["name"] as? String == "GET card_issuers" })
+        let parent = try XCTUnwrap(spans.first { $0["name"] as? String == "core_methods.issuers" })
+        XCTAssertEqual(child["parentSpanId"] as? String, parent["spanId"] as? String)
+        XCTAssertEqual((parent["status"] as? [String: Any])?["code"] as? Int, 2)
+        XCTAssertNotNil(UInt64(parent["startTimeUnixNano"] as? String ?? ""))
+    }
+}
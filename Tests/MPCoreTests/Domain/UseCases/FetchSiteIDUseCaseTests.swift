@@ -17,6 +17,7 @@ private extension FetchSiteIDUseCaseTests {
     )
 
     func makeSUT(
+        store: SiteIDStore = SiteIDStore(fileURL: nil),
         file _: StaticString = #filePath,
         line _: UInt = #line
     ) -> SUT {
@@ -25,11 +26,22 @@ private extension FetchSiteIDUseCaseTests {
         let session = dependencies.mockSession
 
         let repository = SiteRepository(dependencies: dependencies)
-        let sut = FetchSiteIDUseCase(dependencies: dependencies, repository: repository)
+        let sut = FetchSiteIDUseCase(dependencies: dependencies, repository: repository, store: store)
 
         return (sut, session)
     }
 
+    func makeStore() -> SiteIDStore {
+        let fileURL = FileManager.default.temporaryDirectory
+            .appendingPathComponent(UUID().uuidString, isDirectory: true)
+            .appendingPathComponent("site_ids.plist")
+
+        addTeardownBlock {
+            try? FileManager.default.removeItem(at: fileURL.deletingLastPathComponent())
+        }
+        return SiteIDStore(fileURL: fileURL)
+    }
+
     private func makeSuccessResponse(url: URL = URL(string: "http://example.com")!) -> HTTPURLResponse {
         HTTPURLResponse(url: url, statusCode: 200, httpVersion: nil, headerFields: nil)!
     }
@@ -76,30 +88,44 @@ final class FetchSiteIDUseCaseTests: XCTestCase {
 extension FetchSiteIDUseCaseTests {
     // MARK: - Error Handling Tests
 
-    func test_getSiteID_WithPersistentNetworkError_ShouldReturnCountryDefaultAndMaxRetries() async {
+    func test_getSiteID_WithNonTransientError_ShouldReturnCountryDefaultWithoutRetrying() async {
         let (sut, session) = self.makeSUT()
 
         let networkError = NSError(domain: "NetworkError", code: -1)
         await session.mock.setError(networkError)
 
         let result = await sut.getSiteID(with: "public_key", and: .ARG)
+        let requests = await session.mock.requests
+
+        XCTAssertEqual(result, "MLA")
+        XCTAssertEqual(requests.count, 1)
+    }
+
+    func test_getSiteID_WithPersistentTimeout_ShouldReturnCountryDefaultAfterMaxAttempts() async {
+        let (sut, session) = self.makeSUT()
+
+        await session.mock.setError(URLError(.timedOut))
+
+        let result = await sut.getSiteID(with: "public_key", and: .ARG)
+        let requests = await session.mock.requests
 
         XCTAssertEqual(result, "MLA")
-        XCTAssertEqual(sut.currentRetry, 3)
+        XCTAssertEqual(requests.count, RetryPolicy.default.maximumAttempts)
     }
 
     // MARK: - Network Error Tests
 
-    func test_getSiteID_WithInvalidJSON_ShouldRetryAndEventuallyReturnCountryDefault() async {
+    func test_getSiteID_WithInvalidJSON_ShouldReturnCountryDefaultWithoutRetrying() async {
         let (sut, session) = self.makeSUT()
 
         await session.mock.setResponse(self.makeSuccessResponse())
         await session.mock.setData("invalid json".data(using: .utf8)!)
 
         let result = await sut.getSiteID(with: "test_key", and: .ARG)
+        let requests = await session.mock.requests
 
         XCTAssertEqual(result, "MLA")
-        XCTAssertEqual(sut.currentRetry, 3)
+        XCTAssertEqual(requests.count, 1)
     }
 
     // MARK: - Cache Storage Tests
@@ -119,4 +145,37 @@ extension FetchSiteIDUseCaseTests {
         XCTAssertEqual(firstCallResult, expectedSiteID)
         XCTAssertEqual(secondCallResult, expectedSiteID)
     }
+
+    // MARK: - Persistence Tests
+
+    func test_getSiteID_SuccessfulFetch_ShouldPersistSiteIDPerPublicKey() async throws {
+        let store = self.makeStore()
+        let (sut, session) = self.makeSUT(store: store)
+
+        let data = try JSONEncoder().encode(SiteResponse(id: "MCO"))
+        await session.mock.setResponse(self.makeSuccessResponse())
+        await session.mock.setData(data)
+
+        _ = await sut.getSiteID(with: "key_co", and: .COL)
+
+        XCTAssertEqual(sut.storedSiteID(for: "key_co"), "MCO")
+        XCTAssertNil(sut.storedSiteID(for: "other_key"))
+    }
+
+    func test_getSiteID_WhenRequestFails_ShouldReturnPersistedSiteID() async {
+        let store = self.makeStore()
+        store.store("MLU", for: "public_key")
+        let (sut, session) = self.makeSUT(store: store)
+
+        await session.mock.setError(NSError(domain: "NetworkError", code: -1))
+
+        let result = await sut.getSiteID(with: "public_key", and: .ARG)
+
+        XCTAssertEqual(result, "MLU")
+    }
+
+    func test_countrySiteID_ShouldMapColombiaAndChileToDistinctSites() {
+        XCTAssertEqual(MercadoPagoSDK.Country.COL.getSiteId(), "MCO")
+        XCTAssertEqual(MercadoPagoSDK.Country.CHL.getSiteId(), "MLC")
+    }
 }
@@ -9,8 +9,30 @@ import CommonTests
 @testable import MPCore
 import XCTest
 
-private class MockFetchSiteIDUseCase: FetchSiteIDUseCaseProtocol {
+private final class MockFetchSiteIDUseCase: FetchSiteIDUseCaseProtocol, @unchecked Sendable {
     var result = "MLB"
+    var stored: String?
+
+    /// Blocks the stored site ID read until signaled, when set.
+    var storedReadGate: DispatchSemaphore?
+
+    private let lock = NSLock()
+    private var storedReads = 0
+
+    /// Times the stored site ID was read, once per start of the SDK.
+    var storedReadCount: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return storedReads
+    }
+
+    func storedSiteID(for _: String) -> String? {
+        lock.lock()
+        storedReads += 1
+        lock.unlock()
+        self.storedReadGate?.wait()
+        return self.stored
+    }
 
     func getSiteID(with _: String, and _: MPCore.MercadoPagoSDK.Country) async -> String {
         self.result
@@ -86,4 +108,204 @@ final class MercadoPagoSDKTests: XCTestCase {
 
         XCTAssertEqual(sut.getPublicKey(), "test_key")
     }
+
+    // MARK: - Site ID Tests
+
+    func test_initialize_WithStoredSiteID_ShouldUseItBeforeRevalidation() async {
+        let (sut, analytics, siteIDUseCase) = self.makeSUT()
+        siteIDUseCase.stored = "MLU"
+        siteIDUseCase.result = "MLA"
+
+        sut.initialize(MercadoPagoSDK.Configuration(publicKey: "test_key", country: .URY))
+        await sut.analyticsMonitoringTask?.value
+        await sut.siteIDTask?.value
+
+        let messages = await analytics.mock.getMessages()
+        XCTAssertEqual(messages.first, .initialize(version: MPSDKVersion.version, siteID: "MLU"))
+        XCTAssertEqual(sut.siteID, "MLA")
+    }
+
+    func test_initialize_WhenRevalidatedSiteIDDiffers_ShouldUpdateAnalyticsContext() async {
+        let (sut, analytics, siteIDUseCase) = self.makeSUT()
+        siteIDUseCase.stored = "MLU"
+        siteIDUseCase.result = "MLA"
+
+        sut.initialize(MercadoPagoSDK.Configuration(publicKey: "test_key", country: .URY))
+        await sut.siteIDTask?.value
+        await sut.analyticsMonitoringTask?.value
+
+        XCTAssertEqual(analytics.updatedSiteIDs.last, "MLA")
+    }
+
+    func test_siteID_BeforeResolution_ShouldFallBackToCountry() {
+        let (sut, _, _) = self.makeSUT()
+
+        XCTAssertEqual(sut.siteID, "")
+
+        sut.configuration = MercadoPagoSDK.Configuration(publicKey: "test_key", country: .COL)
+
+        XCTAssertEqual(sut.siteID, "MCO")
+    }
+
+    // MARK: - Preconnect Tests
+
+    func test_initialize_ShouldPreconnectToAPIHost() async {
+        let container = MockDependencyContainer()
+        let sut = MercadoPagoSDK(dependencies: container, useCase: MockFetchSiteIDUseCase())
+
+        sut.initialize(MercadoPagoSDK.Configuration(publicKey: "test_key", country: .BRA))
+        await sut.preconnectTask?.value
+
+        let requests = await container.mockSession.mock.requests
+        XCTAssertEqual(requests.map(\.httpMethod), ["HEAD"])
+        XCTAssertEqual(requests.first?.url?.host, "api.mercadopago.com")
+    }
+
+    func test_initialize_WithPreconnectDisabled_ShouldNotSendRequests() async {
+        let container = MockDependencyContainer()
+        let sut = MercadoPagoSDK(dependencies: container, useCase: MockFetchSiteIDUseCase())
+        let network = MercadoPagoSDK.NetworkConfiguration(preconnectsOnInitialize: false)
+
+        sut.initialize(MercadoPagoSDK.Configuration(publicKey: "test_key", country: .BRA, network: network))
+
+        let requests = await container.mockSession.mock.requests
+        XCTAssertNil(sut.preconnectTask)
+        XCTAssertTrue(requests.isEmpty)
+    }
+
+    // MARK: - Startup Tests
+
+    func test_initialize_WithDeferredStartup_ShouldOnlyRecordConfiguration() async {
+        // Given
+        let container = MockDependencyContainer()
+        let sut = MercadoPagoSDK(dependencies: container, useCase: MockFetchSiteIDUseCase())
+
+        // When
+        sut.initialize(MercadoPagoSDK.Configuration(publicKey: "test_key", country: .BRA, startup: .deferred))
+
+        // Then
+        let messages = await container.mockAnalytics.mock.getMessages()
+        let requests = await container.mockSession.mock.requests
+        XCTAssertTrue(sut.isInitialized)
+        XCTAssertNil(sut.siteIDTask)
+        XCTAssertNil(sut.preconnectTask)
+        XCTAssertNil(sut.analyticsMonitoringTask)
+        XCTAssertTrue(messages.isEmpty)
+        XCTAssertTrue(requests.isEmpty)
+        XCTAssertEqual(sut.startupMetrics().mode, .deferred)
+    }
+
+    func test_warmUp_WithDeferredStartup_ShouldStartSubsystemsOnce() async {
+        // Given
+        let (sut, analytics, _) = self.makeSUT()
+        sut.initialize(MercadoPagoSDK.Configuration(publicKey: "test_key", country: .BRA, startup: .deferred))
+
+        // When
+        sut.warmUp()
+        let siteIDTask = sut.siteIDTask
+        sut.warmUp()
+        await sut.analyticsMonitoringTask?.value
+
+        // Then
+        let messages = await analytics.mock.getMessages()
+        XCTAssertNotNil(siteIDTask)
+        XCTAssertEqual(sut.siteIDTask, siteIDTask)
+        XCTAssertEqual(messages.first, .initialize(version: MPSDKVersion.version, siteID: "MLB"))
+    }
+
+    func test_getPublicKey_WithDeferredStartup_ShouldNotStartSubsystems() {
+        // Given
+        let (sut, _, siteIDUseCase) = self.makeSUT()
+        sut.initialize(MercadoPagoSDK.Configuration(publicKey: "test_key", country: .BRA, startup: .deferred))
+
+        // When
+        let publicKey = sut.getPublicKey()
+        let siteID = sut.siteID
+
+        // Then
+        XCTAssertEqual(publicKey, "test_key")
+        XCTAssertEqual(siteID, "MLB")
+        XCTAssertNil(sut.siteIDTask)
+        XCTAssertEqual(siteIDUseCase.storedReadCount, 0)
+    }
+
+    func test_prefetchSiteID_WithDeferredStartup_ShouldStartSubsystemsOnFirstUse() async {
+        // Given
+        let (sut, _, siteIDUseCase) = self.makeSUT()
+        siteIDUseCase.result = "MLA"
+        sut.initialize(MercadoPagoSDK.Configuration(publicKey: "test_key", country: .BRA, startup: .deferred))
+
+        // When
+        await sut.prefetchSiteID()
+
+        // Then
+        XCTAssertNotNil(sut.analyticsMonitoringTask)
+        XCTAssertEqual(siteIDUseCase.storedReadCount, 1)
+        XCTAssertEqual(sut.siteID, "MLA")
+    }
+
+    func test_initialize_WithImmediateStartup_ShouldReadStoredSiteIDOffCallerThread() async {
+        // Given
+        let (sut, _, siteIDUseCase) = self.makeSUT()
+        let gate = DispatchSemaphore(value: 0)
+        siteIDUseCase.stored = "MLU"
+        siteIDUseCase.result = "MLU"
+        siteIDUseCase.storedReadGate = gate
+
+        // When
+        sut.initialize(MercadoPagoSDK.Configuration(publicKey: "test_key", country: .URY))
+        let siteIDTask = sut.siteIDTask
+        gate.signal()
+        await siteIDTask?.value
+
+        // Then
+        XCTAssertNotNil(siteIDTask)
+        XCTAssertEqual(siteIDUseCase.storedReadCount, 1)
+        XCTAssertEqual(sut.siteID, "MLU")
+    }
+
+    func test_startIfNeeded_WithConcurrentFirstUses_ShouldStartOnceAndPublishTasks() async {
+        // Given
+        let (sut, _, siteIDUseCase) = self.makeSUT()
+        sut.initialize(MercadoPagoSDK.Configuration(publicKey: "test_key", country: .BRA, startup: .deferred))
+        let lock = NSLock()
+        var tasks: [Task<String, Never>?] = []
+
+        // When
+        DispatchQueue.concurrentPerform(iterations: 16) { _ in
+            sut.startIfNeeded()
+            let task = sut.siteIDTask
+            lock.lock()
+            tasks.append(task)
+            lock.unlock()
+        }
+        await sut.prefetchSiteID()
+        await sut.analyticsMonitoringTask?.value
+
+        // Then
+        XCTAssertEqual(tasks.count, 16)
+        XCTAssertTrue(tasks.allSatisfy { $0 != nil && $0 == sut.siteIDTask })
+        XCTAssertEqual(siteIDUseCase.storedReadCount, 1)
+        XCTAssertEqual(sut.siteID, "MLB")
+    }
+
+    func test_warmUp_BeforeInitialize_ShouldDoNothing() {
+        let (sut, _, _) = self.makeSUT()
+
+        sut.warmUp()
+
+        XCTAssertNil(sut.siteIDTask)
+        XCTAssertNil(sut.startupMetrics().mode)
+    }
+
+    func test_startupMetrics_WithImmediateStartup_ShouldIncludeStartInLaunchCost() {
+        let (sut, _, _) = self.makeSUT()
+
+        sut.initialize(MercadoPagoSDK.Configuration(publicKey: "test_key", country: .BRA))
+
+        let metrics = sut.startupMetrics()
+        XCTAssertEqual(metrics.mode, .immediate)
+        XCTAssertGreaterThanOrEqual(metrics.initializeMicroseconds, metrics.startMicroseconds)
+        XCTAssertEqual(metrics.launchMicroseconds, metrics.sharedInstanceMicroseconds + metrics.initializeMicroseconds)
+    }
 }
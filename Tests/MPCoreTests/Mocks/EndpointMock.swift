@@ -16,4 +16,9 @@ struct EndpointMock: RequestEndpoint {
     var urlParams: [String: CustomStringConvertible] = [:]
     var body: Data? = nil
     var apiVersion: APIVersion = .v1
+    var retryPolicy: RetryPolicy = .none
+    var hedgingPolicy: HedgingPolicy? = nil
+    var priority: RequestPriority = .interactive
+    var circuitBreakerPolicy: CircuitBreakerPolicy? = nil
+    var rateLimitPolicy: RateLimitPolicy? = nil
 }
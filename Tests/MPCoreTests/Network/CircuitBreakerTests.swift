@@ -0,0 +1,151 @@
+//
+//  CircuitBreakerTests.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+@testable import MPCore
+import XCTest
+
+private final class ManualClock: @unchecked Sendable {
+    var now: TimeInterval = 0
+}
+
+private extension CircuitBreakerTests {
+    typealias SUT = (
+        sut: CircuitBreaker,
+        clock: ManualClock
+    )
+
+    func makeSUT(file _: StaticString = #filePath, line _: UInt = #line) -> SUT {
+        let clock = ManualClock()
+        let sut = CircuitBreaker(now: { clock.now })
+
+        return (sut, clock)
+    }
+
+    var policy: CircuitBreakerPolicy {
+        CircuitBreakerPolicy(windowSize: 4, minimumRequests: 4, failureRateThreshold: 0.5, openDuration: 10)
+    }
+
+    func send(_ outcome: CircuitBreaker.Outcome, to sut: CircuitBreaker, times: Int = 1) throws {
+        for _ in 0 ..< times {
+            let admission = try sut.admit("payment_methods", policy: self.policy)
+            sut.record(outcome, for: admission, policy: self.policy)
+        }
+    }
+}
+
+final class CircuitBreakerTests: XCTestCase {
+    func test_admit_whenFailureRateReachesThreshold_shouldOpenAndFailFast() throws {
+        // Given
+        let (sut, clock) = self.makeSUT()
+        try self.send(.success, to: sut, times: 2)
+        try self.send(.failure, to: sut, times: 2)
+
+        // When
+        clock.now = 4
+
+        // Then
+        XCTAssertEqual(sut.state(of: "payment_methods"), .open)
+        XCTAssertThrowsError(try sut.admit("payment_methods", policy: self.policy)) { error in
+            guard case let .circuitOpen(retryAfter) = error as? APIClientError else {
+                return XCTFail("Expected circuitOpen but got \(error)")
+            }
+            XCTAssertEqual(retryAfter, 6, accuracy: 0.0001)
+        }
+        XCTAssertEqual(sut.state(of: "issuers"), .closed)
+    }
+
+    func test_admit_withFewerThanMinimumRequests_shouldStayClosed() throws {
+        let (sut, _) = self.makeSUT()
+
+        try self.send(.failure, to: sut, times: 3)
+
+        XCTAssertEqual(sut.state(of: "payment_methods"), .closed)
+    }
+
+    func test_admit_afterOpenDuration_shouldLetOneProbeThroughAndCloseOnSuccess() throws {
+        // Given
+        let (sut, clock) = self.makeSUT()
+        try self.send(.failure, to: sut, times: 4)
+        clock.now = 10
+
+        // When
+        let probe = try sut.admit("payment_methods", policy: self.policy)
+
+        // Then
+        XCTAssertEqual(sut.state(of: "payment_methods"), .halfOpen)
+        XCTAssertThrowsError(try sut.admit("payment_methods", policy: self.policy))
+
+        sut.record(.success, for: probe, policy: self.policy)
+        XCTAssertEqual(sut.state(of: "payment_methods"), .closed)
+        XCTAssertNoThrow(try sut.admit("payment_methods", policy: self.policy))
+    }
+
+    func test_record_whenAttemptAdmittedBeforeOpeningSucceedsLate_shouldNotCountAsProbe() throws {
+        // Given
+        let (sut, clock) = self.makeSUT()
+        let lateAttempt = try sut.admit("payment_methods", policy: self.policy)
+        try self.send(.failure, to: sut, times: 4)
+        clock.now = 10
+        let probe = try sut.admit("payment_methods", policy: self.policy)
+
+        // When
+        sut.record(.success, for: lateAttempt, policy: self.policy)
+
+        // Then
+        XCTAssertEqual(sut.state(of: "payment_methods"), .halfOpen)
+        XCTAssertThrowsError(try sut.admit("payment_methods", policy: self.policy))
+
+        sut.record(.success, for: probe, policy: self.policy)
+        XCTAssertEqual(sut.state(of: "payment_methods"), .closed)
+    }
+
+    func test_record_whenProbeFails_shouldOpenAgain() throws {
+        // Given
+        let (sut, clock) = self.makeSUT()
+        try self.send(.failure, to: sut, times: 4)
+        clock.now = 10
+
+        // When
+        try self.send(.failure, to: sut)
+
+        // Then
+        XCTAssertEqual(sut.state(of: "payment_methods"), .open)
+        clock.now = 19
+        XCTAssertThrowsError(try sut.admit("payment_methods", policy: self.policy))
+    }
+
+    func test_record_whenProbeIsIgnored_shouldReleaseProbe() throws {
+        let (sut, clock) = self.makeSUT()
+        try self.send(.failure, to: sut, times: 4)
+        clock.now = 10
+
+        try self.send(.ignored, to: sut)
+
+        XCTAssertNoThrow(try sut.admit("payment_methods", policy: self.policy))
+    }
+
+    func test_snapshot_shouldCountTransitionsAndRejections() throws {
+        // Given
+        let (sut, clock) = self.makeSUT()
+        try self.send(.failure, to: sut, times: 4)
+        _ = try? sut.admit("payment_methods", policy: self.policy)
+
+        // When
+        clock.now = 10
+        try self.send(.success, to: sut)
+
+        // Then
+        let metrics = sut.snapshot()
+        XCTAssertEqual(metrics.count, 1)
+        XCTAssertEqual(metrics.first?.endpoint, "payment_methods")
+        XCTAssertEqual(metrics.first?.state, .closed)
+        XCTAssertEqual(metrics.first?.opened, 1)
+        XCTAssertEqual(metrics.first?.halfOpened, 1)
+        XCTAssertEqual(metrics.first?.closed, 1)
+        XCTAssertEqual(metrics.first?.rejected, 1)
+    }
+}
@@ -0,0 +1,44 @@
+//
+//  HedgingControllerTests.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+@testable import MPCore
+import XCTest
+
+final class HedgingControllerTests: XCTestCase {
+    func test_delay_withoutEnoughSamples_shouldUseFallbackDelay() {
+        let sut = HedgingController()
+        let policy = HedgingPolicy(fallbackDelay: 0.4, minimumSamples: 3)
+
+        sut.record(0.1, for: "/v1/payment_methods")
+
+        XCTAssertEqual(sut.delay(for: "/v1/payment_methods", policy: policy), 0.4)
+    }
+
+    func test_delay_shouldFollowObservedPercentileWithinBounds() {
+        let sut = HedgingController()
+        let policy = HedgingPolicy(percentile: 0.9, minimumDelay: 0.05, maximumDelay: 1, minimumSamples: 10)
+
+        for index in 1 ... 10 {
+            sut.record(Double(index) / 10, for: "/v1/installments")
+        }
+
+        XCTAssertEqual(sut.delay(for: "/v1/installments", policy: policy), 1, accuracy: 0.0001)
+        XCTAssertEqual(sut.delay(for: "/v1/issuers", policy: policy), policy.fallbackDelay)
+    }
+
+    func test_latencyWindow_shouldKeepOnlyLatestSamples() {
+        var sut = HedgingController.LatencyWindow()
+
+        for _ in 0 ..< HedgingController.LatencyWindow.capacity {
+            sut.record(5)
+        }
+        sut.record(0.1)
+
+        XCTAssertEqual(sut.count, HedgingController.LatencyWindow.capacity)
+        XCTAssertEqual(sut.percentile(0), 0.1)
+    }
+}
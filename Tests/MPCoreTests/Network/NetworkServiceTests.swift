@@ -15,9 +15,20 @@ private extension NetworkServiceTests {
         session: MockURLSession
     )
 
-    func makeSUT(file _: StaticString = #filePath, line _: UInt = #line) -> SUT {
+    func makeSUT(
+        retryBudget: RetryBudget = RetryBudget(),
+        hedging: HedgingController = HedgingController(),
+        configuration: MercadoPagoSDK.NetworkConfiguration = .default,
+        file _: StaticString = #filePath,
+        line _: UInt = #line
+    ) -> SUT {
         let session = MockURLSession()
-        let sut = NetworkService(session: session)
+        let sut = NetworkService(
+            session: session,
+            configuration: configuration,
+            retryBudget: retryBudget,
+            hedging: hedging
+        )
 
         return (sut, session)
     }
@@ -26,8 +37,20 @@ private extension NetworkServiceTests {
         HTTPURLResponse(url: url, statusCode: 200, httpVersion: nil, headerFields: nil)!
     }
 
-    private func makeErrorResponse(statusCode: Int, url: URL = URL(string: "http://example.com")!) -> HTTPURLResponse {
-        HTTPURLResponse(url: url, statusCode: statusCode, httpVersion: nil, headerFields: nil)!
+    private func makeErrorResponse(
+        statusCode: Int,
+        headers: [String: String]? = nil,
+        url: URL = URL(string: "http://example.com")!
+    ) -> HTTPURLResponse {
+        HTTPURLResponse(url: url, statusCode: statusCode, httpVersion: nil, headerFields: headers)!
+    }
+
+    var immediateRetryPolicy: RetryPolicy {
+        RetryPolicy(maximumAttempts: 3, initialDelay: 0)
+    }
+
+    var fastHedgingPolicy: HedgingPolicy {
+        HedgingPolicy(minimumDelay: 0.02, maximumDelay: 0.2, fallbackDelay: 0.05, minimumSamples: 5)
     }
 }
 
@@ -185,4 +208,591 @@ class NetworkServiceTests: XCTestCase {
             XCTFail("Expected APIClientError but got \(error)")
         }
     }
+
+    // MARK: - Session Configuration Tests
+
+    func test_makeSessionConfiguration_shouldApplyNetworkConfiguration() {
+        // Given
+        let configuration = MercadoPagoSDK.NetworkConfiguration(
+            requestTimeout: 7,
+            resourceTimeout: 21,
+            maximumConnectionsPerHost: 2,
+            memoryCacheCapacity: 1024,
+            diskCacheCapacity: 4096
+        )
+
+        // When
+        let sessionConfiguration = NetworkService.makeSessionConfiguration(configuration)
+
+        // Then
+        XCTAssertEqual(sessionConfiguration.timeoutIntervalForRequest, 7)
+        XCTAssertEqual(sessionConfiguration.timeoutIntervalForResource, 21)
+        XCTAssertEqual(sessionConfiguration.httpMaximumConnectionsPerHost, 2)
+        XCTAssertEqual(sessionConfiguration.requestCachePolicy, .useProtocolCachePolicy)
+        XCTAssertEqual(sessionConfiguration.urlCache?.memoryCapacity, 1024)
+        XCTAssertEqual(sessionConfiguration.urlCache?.diskCapacity, 4096)
+    }
+
+    func test_configure_withInjectedSession_shouldKeepUsingInjectedSession() async throws {
+        // Given
+        let (sut, session) = self.makeSUT()
+        let mockData = Data("""
+        {
+            "sucess": true
+        }
+        """.utf8)
+        await session.mock.setData(mockData)
+        await session.mock.setResponse(self.makeSuccessResponse())
+
+        // When
+        sut.configure(MercadoPagoSDK.NetworkConfiguration(requestTimeout: 1))
+        let result: MockResponse = try await sut.request(EndpointMock())
+
+        // Then
+        XCTAssertEqual(result, MockResponse(sucess: true))
+    }
+
+    // MARK: - Coalescing Tests
+
+    func test_request_withConcurrentIdenticalGets_shouldShareOneRoundTrip() async throws {
+        // Given
+        let (sut, session) = self.makeSUT()
+        await session.mock.setData(Data(#"{ "sucess": true }"#.utf8))
+        await session.mock.setResponse(self.makeSuccessResponse())
+        await session.mock.setDelay(nanoseconds: 200_000_000)
+
+        // When
+        async let first: MockResponse = sut.request(EndpointMock())
+        async let second: MockResponse = sut.request(EndpointMock())
+        async let third: MockResponse = sut.request(EndpointMock())
+        let results = try await [first, second, third]
+
+        // Then
+        let requests = await session.mock.requests
+        XCTAssertEqual(results, Array(repeating: MockResponse(sucess: true), count: 3))
+        XCTAssertEqual(requests.count, 1)
+        XCTAssertEqual(sut.coalescingStatistics, RequestCoalescer.Statistics(started: 1, coalesced: 2))
+    }
+
+    func test_request_whenInteractiveGetMatchesBackgroundPrefetch_shouldNotJoinIt() async throws {
+        // Given
+        let (sut, session) = self.makeSUT()
+        await session.mock.setData(Data(#"{ "sucess": true }"#.utf8))
+        await session.mock.setResponse(self.makeSuccessResponse())
+        await session.mock.setDelay(nanoseconds: 200_000_000)
+
+        // When
+        async let prefetch: MockResponse = RequestPriority.$override.withValue(.background) {
+            try await sut.request(EndpointMock())
+        }
+        async let interactive: MockResponse = sut.request(EndpointMock())
+        _ = try await [prefetch, interactive]
+
+        // Then
+        let requests = await session.mock.requests
+        let lanes = try XCTUnwrap(sut.scheduler?.snapshot())
+        XCTAssertEqual(requests.count, 2)
+        XCTAssertEqual(lanes.map(\.requests), [0, 1, 1])
+        XCTAssertEqual(sut.coalescingStatistics, RequestCoalescer.Statistics(started: 2, coalesced: 0))
+    }
+
+    func test_request_withConcurrentPosts_shouldNotCoalesce() async throws {
+        // Given
+        let (sut, session) = self.makeSUT()
+        let endpoint = EndpointMock(method: .post)
+        await session.mock.setData(Data(#"{ "sucess": true }"#.utf8))
+        await session.mock.setResponse(self.makeSuccessResponse())
+        await session.mock.setDelay(nanoseconds: 100_000_000)
+
+        // When
+        async let first: MockResponse = sut.request(endpoint)
+        async let second: MockResponse = sut.request(endpoint)
+        _ = try await [first, second]
+
+        // Then
+        let requests = await session.mock.requests
+        XCTAssertEqual(requests.count, 2)
+        XCTAssertEqual(sut.coalescingStatistics, RequestCoalescer.Statistics())
+    }
+
+    func test_request_whenOneCallerIsCancelled_shouldStillDeliverToOthers() async throws {
+        // Given
+        let (sut, session) = self.makeSUT()
+        await session.mock.setData(Data(#"{ "sucess": true }"#.utf8))
+        await session.mock.setResponse(self.makeSuccessResponse())
+        await session.mock.setDelay(nanoseconds: 300_000_000)
+
+        // When
+        let cancelled = Task { () -> MockResponse in try await sut.request(EndpointMock()) }
+        let kept = Task { () -> MockResponse in try await sut.request(EndpointMock()) }
+        try await Task.sleep(nanoseconds: 50_000_000)
+        cancelled.cancel()
+
+        // Then
+        let result = try await kept.value
+        XCTAssertEqual(result, MockResponse(sucess: true))
+        do {
+            _ = try await cancelled.value
+            XCTFail("Expected cancellation but got success")
+        } catch {
+            XCTAssertTrue(error is CancellationError)
+        }
+        let requests = await session.mock.requests
+        XCTAssertEqual(requests.count, 1)
+    }
+
+    // MARK: - Retry
+
+    func test_request_whenStatusCodeIsTransient_shouldRetryUpToMaximumAttempts() async {
+        // Given
+        let (sut, session) = self.makeSUT()
+        let endpoint = EndpointMock(retryPolicy: self.immediateRetryPolicy)
+        await session.mock.setData(Data())
+        await session.mock.setResponse(self.makeErrorResponse(statusCode: 503))
+
+        // When
+        do {
+            let _: MockResponse = try await sut.request(endpoint)
+            XCTFail("Expected error but got success")
+        } catch {
+            guard case .statusCode(503) = error as? APIClientError else {
+                return XCTFail("Expected status code 503 but got \(error)")
+            }
+        }
+
+        // Then
+        let requests = await session.mock.requests
+        XCTAssertEqual(requests.count, 3)
+    }
+
+    func test_request_whenStatusCodeIsClientError_shouldNotRetry() async {
+        // Given
+        let (sut, session) = self.makeSUT()
+        let endpoint = EndpointMock(retryPolicy: self.immediateRetryPolicy)
+        await session.mock.setData(Data())
+        await session.mock.setResponse(self.makeErrorResponse(statusCode: 400))
+
+        // When
+        let _: MockResponse? = try? await sut.request(endpoint)
+
+        // Then
+        let requests = await session.mock.requests
+        XCTAssertEqual(requests.count, 1)
+    }
+
+    func test_request_whenRetryAfterExceedsMaximumDelay_shouldNotRetry() async {
+        // Given
+        let (sut, session) = self.makeSUT()
+        let endpoint = EndpointMock(retryPolicy: self.immediateRetryPolicy)
+        await session.mock.setData(Data())
+        await session.mock.setResponse(self.makeErrorResponse(statusCode: 429, headers: ["Retry-After": "120"]))
+
+        // When
+        let _: MockResponse? = try? await sut.request(endpoint)
+
+        // Then
+        let requests = await session.mock.requests
+        XCTAssertEqual(requests.count, 1)
+    }
+
+    func test_request_whenPostHasNoIdempotencyKey_shouldNotRetry() async {
+        // Given
+        let (sut, session) = self.makeSUT()
+        let endpoint = EndpointMock(method: .post, retryPolicy: self.immediateRetryPolicy)
+        await session.mock.setError(URLError(.timedOut))
+
+        // When
+        let _: MockResponse? = try? await sut.request(endpoint)
+
+        // Then
+        let requests = await session.mock.requests
+        XCTAssertEqual(requests.count, 1)
+    }
+
+    func test_request_whenPostIsIdempotent_shouldRetryWithSameIdempotencyKey() async {
+        // Given
+        let (sut, session) = self.makeSUT()
+        let endpoint = EndpointMock(method: .post, retryPolicy: self.immediateRetryPolicy.idempotent())
+        await session.mock.setError(URLError(.timedOut))
+
+        // When
+        let _: MockResponse? = try? await sut.request(endpoint)
+
+        // Then
+        let keys = await session.mock.requests.map { $0.value(forHTTPHeaderField: RetryPolicy.idempotencyKeyHeader) }
+        XCTAssertEqual(keys.count, 3)
+        XCTAssertNotNil(keys.first ?? nil)
+        XCTAssertEqual(Set(keys).count, 1)
+    }
+
+    func test_request_whenRetryBudgetIsSpent_shouldStopRetrying() async {
+        // Given
+        let (sut, session) = self.makeSUT(retryBudget: RetryBudget(capacity: 1))
+        let endpoint = EndpointMock(retryPolicy: self.immediateRetryPolicy)
+        await session.mock.setError(URLError(.networkConnectionLost))
+
+        // When
+        let _: MockResponse? = try? await sut.request(endpoint)
+
+        // Then
+        let requests = await session.mock.requests
+        XCTAssertEqual(requests.count, 2)
+    }
+
+    // MARK: - Hedging
+
+    func test_request_whenResponseStalls_shouldReturnHedgedResponse() async throws {
+        // Given
+        let (sut, session) = self.makeSUT()
+        let endpoint = EndpointMock(hedgingPolicy: self.fastHedgingPolicy)
+        await session.mock.setData(Data(#"{ "sucess": true }"#.utf8))
+        await session.mock.setResponse(self.makeSuccessResponse())
+        await session.mock.setDelays(nanoseconds: [5_000_000_000, 0])
+
+        // When
+        let start = Date()
+        let result: MockResponse = try await sut.request(endpoint)
+        let elapsed = Date().timeIntervalSince(start)
+
+        // Then
+        let requests = await session.mock.requests
+        XCTAssertEqual(result, MockResponse(sucess: true))
+        XCTAssertEqual(requests.count, 2)
+        XCTAssertLessThan(elapsed, 1)
+        XCTAssertEqual(sut.hedgingStatistics, HedgingController.Statistics(hedged: 1, won: 1))
+    }
+
+    func test_request_whenResponseIsFast_shouldNotHedge() async throws {
+        // Given
+        let (sut, session) = self.makeSUT()
+        let endpoint = EndpointMock(hedgingPolicy: self.fastHedgingPolicy)
+        await session.mock.setData(Data(#"{ "sucess": true }"#.utf8))
+        await session.mock.setResponse(self.makeSuccessResponse())
+
+        // When
+        let _: MockResponse = try await sut.request(endpoint)
+
+        // Then
+        let requests = await session.mock.requests
+        XCTAssertEqual(requests.count, 1)
+        XCTAssertEqual(sut.hedgingStatistics, HedgingController.Statistics())
+    }
+
+    func test_request_whenHedgeBudgetIsSpent_shouldWaitForOriginalRequest() async throws {
+        // Given
+        let hedging = HedgingController(budget: RetryBudget(capacity: 0))
+        let (sut, session) = self.makeSUT(hedging: hedging)
+        let endpoint = EndpointMock(hedgingPolicy: self.fastHedgingPolicy)
+        await session.mock.setData(Data(#"{ "sucess": true }"#.utf8))
+        await session.mock.setResponse(self.makeSuccessResponse())
+        await session.mock.setDelays(nanoseconds: [200_000_000])
+
+        // When
+        let _: MockResponse = try await sut.request(endpoint)
+
+        // Then
+        let requests = await session.mock.requests
+        XCTAssertEqual(requests.count, 1)
+        XCTAssertEqual(sut.hedgingStatistics.hedged, 0)
+    }
+
+    func test_request_withInjectedStalls_shouldBoundTailLatency() async throws {
+        // Given: one request in ten stalls for a second
+        let (sut, session) = self.makeSUT()
+        let stalls = 4
+        let endpoint = EndpointMock(hedgingPolicy: self.fastHedgingPolicy)
+        await session.mock.setData(Data(#"{ "sucess": true }"#.utf8))
+        await session.mock.setResponse(self.makeSuccessResponse())
+        var latencies: [TimeInterval] = []
+
+        // When
+        for index in 0 ..< stalls * 10 {
+            if index % 10 == 9 {
+                await session.mock.setDelays(nanoseconds: [1_000_000_000, 0])
+            }
+            let start = Date()
+            let _: MockResponse = try await sut.request(endpoint)
+            latencies.append(Date().timeIntervalSince(start))
+        }
+
+        // Then
+        let p99 = latencies.sorted()[Int(Double(latencies.count - 1) * 0.99)]
+        XCTAssertLessThan(p99, 0.5)
+        XCTAssertGreaterThanOrEqual(sut.hedgingStatistics.hedged, 1)
+        XCTAssertLessThanOrEqual(sut.hedgingStatistics.hedged, stalls)
+    }
+
+    func test_request_whenRateLimiterRejectsHedge_shouldWaitForOriginalRequest() async throws {
+        // Given
+        let (sut, session) = self.makeSUT()
+        let endpoint = EndpointMock(
+            hedgingPolicy: self.fastHedgingPolicy,
+            rateLimitPolicy: RateLimitPolicy(capacity: 1, refillRate: 0.01)
+        )
+        await session.mock.setData(Data(#"{ "sucess": true }"#.utf8))
+        await session.mock.setResponse(self.makeSuccessResponse())
+        await session.mock.setDelays(nanoseconds: [200_000_000])
+
+        // When
+        let _: MockResponse = try await sut.request(endpoint)
+
+        // Then
+        let requests = await session.mock.requests
+        XCTAssertEqual(requests.count, 1)
+        XCTAssertEqual(sut.hedgingStatistics.hedged, 0)
+    }
+
+    // MARK: - Metrics
+
+    func test_request_shouldRecordTimingPerEndpoint() async throws {
+        // Given
+        let (sut, session) = self.makeSUT()
+        let received = LockedBox<[MercadoPagoSDK.RequestMetrics]>([])
+        sut.metrics?.setHandler { metrics in received.mutate { $0.append(metrics) } }
+        await session.mock.setData(Data(#"{ "sucess": true }"#.utf8))
+        await session.mock.setResponse(self.makeSuccessResponse())
+
+        // When
+        let _: MockResponse = try await sut.request(EndpointMock(path: "payment_methods"))
+
+        // Then
+        let snapshot = try XCTUnwrap(sut.metrics?.snapshot().first)
+        XCTAssertEqual(snapshot.endpoint, "payment_methods")
+        XCTAssertEqual(snapshot.requests, 1)
+        XCTAssertEqual(snapshot.phases[.total]?.count, 1)
+        XCTAssertEqual(snapshot.phases[.decode]?.count, 1)
+        XCTAssertEqual(received.value.map(\.statusCode), [200])
+        XCTAssertEqual(received.value.map(\.attempts), [1])
+    }
+
+    func test_request_whenRetried_shouldRecordAttempts() async {
+        // Given
+        let (sut, session) = self.makeSUT()
+        await session.mock.setError(URLError(.timedOut))
+
+        // When
+        let _: MockResponse? = try? await sut.request(EndpointMock(retryPolicy: self.immediateRetryPolicy))
+
+        // Then
+        let snapshot = sut.metrics?.snapshot().first
+        XCTAssertEqual(snapshot?.requests, 1)
+        XCTAssertEqual(snapshot?.retried, 1)
+        XCTAssertNil(snapshot?.phases[.decode])
+    }
+
+    func test_request_whenTaskMetricsArriveLate_shouldReturnWithoutWaitingForThem() async throws {
+        // Given
+        let session = MockURLSession(reportsTaskMetrics: true)
+        let sut = NetworkService(session: session)
+        await session.mock.setData(Data(#"{ "sucess": true }"#.utf8))
+        await session.mock.setResponse(self.makeSuccessResponse())
+
+        // When
+        let response: MockResponse = try await sut.request(EndpointMock(path: "card_tokens"))
+
+        // Then
+        XCTAssertEqual(response, MockResponse(sucess: true))
+        XCTAssertEqual(sut.metrics?.snapshot().count, 0)
+    }
+
+    func test_latencyHistogram_shouldReportBucketPercentiles() {
+        var sut = MercadoPagoSDK.LatencyHistogram()
+
+        for _ in 0 ..< 99 {
+            sut.record(0.02)
+        }
+        sut.record(3)
+
+        XCTAssertEqual(sut.count, 100)
+        XCTAssertEqual(sut.percentile(0.5), 0.025)
+        XCTAssertEqual(sut.percentile(0.99), 0.025)
+        XCTAssertEqual(sut.percentile(1), 5)
+        XCTAssertEqual(sut.mean ?? 0, 0.0498, accuracy: 0.0001)
+    }
+
+    // MARK: - Scheduling
+
+    func test_request_shouldRunOnEndpointPriorityLane() async throws {
+        // Given
+        let (sut, session) = self.makeSUT()
+        await session.mock.setData(Data(#"{ "sucess": true }"#.utf8))
+        await session.mock.setResponse(self.makeSuccessResponse())
+
+        // When
+        let _: MockResponse = try await sut.request(EndpointMock(method: .post, priority: .critical))
+        let _: MockResponse = try await RequestPriority.$override.withValue(.background) {
+            try await sut.request(EndpointMock(path: "prefetch"))
+        }
+
+        // Then
+        let lanes = try XCTUnwrap(sut.scheduler?.snapshot())
+        XCTAssertEqual(lanes.map(\.requests), [1, 0, 1])
+    }
+
+    // MARK: - Circuit Breaker
+
+    func test_request_whenEndpointKeepsFailing_shouldFailFastWithoutSending() async {
+        // Given
+        let (sut, session) = self.makeSUT()
+        let policy = CircuitBreakerPolicy(windowSize: 3, minimumRequests: 3, openDuration: 60)
+        let endpoint = EndpointMock(circuitBreakerPolicy: policy)
+        await session.mock.setError(URLError(.timedOut))
+
+        for _ in 0 ..< 3 {
+            let _: MockResponse? = try? await sut.request(endpoint)
+        }
+
+        // When
+        do {
+            let _: MockResponse = try await sut.request(endpoint)
+            XCTFail("Expected error but got success")
+        } catch {
+            guard case .circuitOpen = error as? APIClientError else {
+                return XCTFail("Expected circuitOpen but got \(error)")
+            }
+        }
+
+        // Then
+        let requests = await session.mock.requests
+        XCTAssertEqual(requests.count, 3)
+        XCTAssertEqual(sut.circuitBreaker?.snapshot().first?.state, .open)
+    }
+
+    func test_request_whenClientError_shouldNotOpenCircuit() async {
+        // Given
+        let (sut, session) = self.makeSUT()
+        let endpoint = EndpointMock(circuitBreakerPolicy: CircuitBreakerPolicy(windowSize: 2, minimumRequests: 2))
+        await session.mock.setData(Data())
+        await session.mock.setResponse(self.makeErrorResponse(statusCode: 404))
+
+        // When
+        for _ in 0 ..< 3 {
+            let _: MockResponse? = try? await sut.request(endpoint)
+        }
+
+        // Then
+        let requests = await session.mock.requests
+        XCTAssertEqual(requests.count, 3)
+        XCTAssertEqual(sut.circuitBreaker?.state(of: endpoint.path), .closed)
+    }
+
+    // MARK: - Rate Limiting
+
+    func test_request_whenAnswered429_shouldThrottleUntilRetryAfter() async {
+        // Given
+        let (sut, session) = self.makeSUT()
+        let endpoint = EndpointMock(rateLimitPolicy: .default)
+        await session.mock.setData(Data())
+        await session.mock.setResponse(self.makeErrorResponse(statusCode: 429, headers: ["Retry-After": "30"]))
+        let _: MockResponse? = try? await sut.request(endpoint)
+
+        // When
+        do {
+            let _: MockResponse = try await sut.request(endpoint)
+            XCTFail("Expected error but got success")
+        } catch {
+            guard case let .rateLimited(retryAfter) = error as? APIClientError else {
+                return XCTFail("Expected rateLimited but got \(error)")
+            }
+            XCTAssertGreaterThan(retryAfter, 29)
+        }
+
+        // Then
+        let requests = await session.mock.requests
+        XCTAssertEqual(requests.count, 1)
+    }
+
+    func test_request_whenAnswered429WithoutRetryAfter_shouldRetryOnceBackoffElapsed() async throws {
+        // Given
+        let (sut, session) = self.makeSUT()
+        let endpoint = EndpointMock(
+            retryPolicy: RetryPolicy(maximumAttempts: 2, initialDelay: 0.01),
+            rateLimitPolicy: RateLimitPolicy(defaultBackoff: 0.05)
+        )
+        await session.mock.setData(Data(#"{ "sucess": true }"#.utf8))
+        await session.mock.setResponses([self.makeErrorResponse(statusCode: 429), self.makeSuccessResponse()])
+
+        // When
+        let response: MockResponse = try await sut.request(endpoint)
+
+        // Then
+        let requests = await session.mock.requests
+        XCTAssertEqual(response, MockResponse(sucess: true))
+        XCTAssertEqual(requests.count, 2)
+    }
+
+    func test_request_whenBucketIsEmpty_shouldNotSend() async throws {
+        // Given
+        let (sut, session) = self.makeSUT()
+        let endpoint = EndpointMock(rateLimitPolicy: RateLimitPolicy(capacity: 2, refillRate: 0.01))
+        await session.mock.setData(Data(#"{ "sucess": true }"#.utf8))
+        await session.mock.setResponse(self.makeSuccessResponse())
+
+        // When
+        for _ in 0 ..< 3 {
+            let _: MockResponse? = try? await sut.request(endpoint)
+        }
+
+        // Then
+        let requests = await session.mock.requests
+        XCTAssertEqual(requests.count, 2)
+    }
+
+    // MARK: - Keep-alive
+
+    func test_retainConnections_whenIdle_shouldRefreshConnectionUntilReleased() async throws {
+        // Given
+        let (sut, session) = self.makeSUT(configuration: .init(keepAliveInterval: 0.05))
+
+        // When
+        sut.retainConnections()
+        try await Task.sleep(nanoseconds: 300_000_000)
+        sut.releaseConnections()
+        let pings = await session.mock.requests
+        try await Task.sleep(nanoseconds: 200_000_000)
+
+        // Then
+        let requests = await session.mock.requests
+        XCTAssertFalse(pings.isEmpty)
+        XCTAssertTrue(pings.allSatisfy { $0.httpMethod == "HEAD" })
+        XCTAssertLessThanOrEqual(requests.count, pings.count + 1)
+    }
+
+    func test_retainConnections_shouldKeepAliveUntilEveryRetainIsReleased() async throws {
+        // Given
+        let (sut, session) = self.makeSUT(configuration: .init(keepAliveInterval: 0.05))
+
+        // When
+        sut.retainConnections()
+        sut.retainConnections()
+        sut.releaseConnections()
+        try await Task.sleep(nanoseconds: 200_000_000)
+        sut.releaseConnections()
+
+        // Then
+        let requests = await session.mock.requests
+        XCTAssertFalse(requests.isEmpty)
+    }
+}
+
+/// Thread-safe box for values written from `@Sendable` closures.
+private final class LockedBox<Value>: @unchecked Sendable {
+    private let lock = NSLock()
+    private var storage: Value
+
+    init(_ value: Value) {
+        self.storage = value
+    }
+
+    var value: Value {
+        lock.lock()
+        defer { lock.unlock() }
+        return storage
+    }
+
+    func mutate(_ body: (inout Value) -> Void) {
+        lock.lock()
+        defer { lock.unlock() }
+        body(&storage)
+    }
 }
@@ -0,0 +1,66 @@
+//
+//  RateLimiterTests.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+@testable import MPCore
+import XCTest
+
+private final class ManualClock: @unchecked Sendable {
+    var now: TimeInterval = 0
+}
+
+final class RateLimiterTests: XCTestCase {
+    private let policy = RateLimitPolicy(capacity: 2, refillRate: 1, defaultBackoff: 3)
+
+    func test_acquire_whenBucketIsEmpty_shouldThrowUntilRefilled() throws {
+        // Given
+        let clock = ManualClock()
+        let sut = RateLimiter(now: { clock.now })
+        try sut.acquire("installments", policy: self.policy)
+        try sut.acquire("installments", policy: self.policy)
+
+        // Then
+        XCTAssertThrowsError(try sut.acquire("installments", policy: self.policy)) { error in
+            guard case let .rateLimited(retryAfter) = error as? APIClientError else {
+                return XCTFail("Expected rateLimited but got \(error)")
+            }
+            XCTAssertEqual(retryAfter, 1, accuracy: 0.0001)
+        }
+        XCTAssertNoThrow(try sut.acquire("issuers", policy: self.policy))
+
+        clock.now = 1
+        XCTAssertNoThrow(try sut.acquire("installments", policy: self.policy))
+    }
+
+    func test_throttle_shouldBlockForRetryAfterThenAllowOneAttempt() throws {
+        // Given
+        let clock = ManualClock()
+        let sut = RateLimiter(now: { clock.now })
+
+        // When
+        sut.throttle("installments", retryAfter: 5, policy: self.policy)
+
+        // Then
+        clock.now = 4
+        XCTAssertThrowsError(try sut.acquire("installments", policy: self.policy))
+
+        clock.now = 5
+        XCTAssertNoThrow(try sut.acquire("installments", policy: self.policy))
+        XCTAssertThrowsError(try sut.acquire("installments", policy: self.policy))
+    }
+
+    func test_throttle_withoutRetryAfter_shouldUseDefaultBackoff() {
+        let clock = ManualClock()
+        let sut = RateLimiter(now: { clock.now })
+
+        sut.throttle("installments", retryAfter: nil, policy: self.policy)
+
+        clock.now = 2.9
+        XCTAssertThrowsError(try sut.acquire("installments", policy: self.policy))
+        clock.now = 3
+        XCTAssertNoThrow(try sut.acquire("installments", policy: self.policy))
+    }
+}
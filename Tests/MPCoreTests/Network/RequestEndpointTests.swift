@@ -31,4 +31,99 @@ final class RequestEndpointTests: XCTestCase {
         // Then
         XCTAssertTrue(request?.url?.absoluteString.contains("key=value") ?? false)
     }
+
+    func test_urlRequest_shouldSortQueryParametersByName() {
+        // Given
+        var endpoint = EndpointMock()
+        endpoint.urlParams = ["product_id": "abc", "bin": "45099535", "amount": "100.0"]
+
+        // When
+        let query = endpoint.urlRequest?.url?.query
+
+        // Then
+        XCTAssertEqual(query, "amount=100.0&bin=45099535&product_id=abc&public_key=")
+    }
+
+    func test_urlRequest_shouldPercentEncodeQueryValues() {
+        // Given
+        var endpoint = EndpointMock()
+        endpoint.urlParams = ["mode": "a b&c+d"]
+
+        // When
+        let query = endpoint.urlRequest?.url?.query
+
+        // Then
+        XCTAssertEqual(query, "mode=a%20b%26c%2Bd&public_key=")
+    }
+
+    func test_template_shouldBeCompiledOncePerEndpoint() {
+        // Given
+        let endpoint = EndpointMock(path: "payment_methods")
+
+        // When
+        let first = RequestTemplate.template(for: endpoint)
+        let second = RequestTemplate.template(for: endpoint)
+
+        // Then
+        XCTAssertEqual(first?.urlPrefix, "https://api.test.com/v1/payment_methods")
+        XCTAssertEqual(first?.urlPrefix, second?.urlPrefix)
+    }
+
+    func test_urlRequest_shouldUsePublicKeyCapturedByTemplate() {
+        // Given
+        let endpoint = EndpointMock(path: "payment_methods")
+        RequestTemplate.setPublicKey("APP_USR-key")
+        defer { RequestTemplate.setPublicKey("") }
+
+        // When
+        let query = endpoint.urlRequest?.url?.query
+
+        // Then
+        XCTAssertEqual(query, "public_key=APP_USR-key")
+    }
+
+    // MARK: - Performance
+
+    func test_performance_urlRequestFromTemplate() {
+        var endpoint = EndpointMock(path: "payment_methods")
+        endpoint.urlParams = ["bin": "45099535", "product_id": "abc", "processing_mode": "aggregator"]
+
+        measure(metrics: [XCTClockMetric(), XCTMemoryMetric()]) {
+            for _ in 0 ..< 10_000 {
+                _ = endpoint.urlRequest
+            }
+        }
+    }
+
+    func test_performance_urlRequestFromComponents() {
+        var endpoint = EndpointMock(path: "payment_methods")
+        endpoint.urlParams = ["bin": "45099535", "product_id": "abc", "processing_mode": "aggregator"]
+
+        measure(metrics: [XCTClockMetric(), XCTMemoryMetric()]) {
+            for _ in 0 ..< 10_000 {
+                _ = self.componentsRequest(for: endpoint)
+            }
+        }
+    }
+}
+
+// MARK: - Helpers
+
+private extension RequestEndpointTests {
+    /// Per-call `URLComponents` construction used before request templates, kept as a baseline.
+    func componentsRequest(for endpoint: EndpointMock) -> URLRequest? {
+        var components = URLComponents(string: endpoint.baseURL + endpoint.apiVersion.rawValue + endpoint.path)
+        components?.queryItems = endpoint.urlParams.map { key, value in
+            URLQueryItem(name: key, value: String(describing: value))
+        }
+        components?.queryItems?.append(URLQueryItem(name: "public_key", value: MercadoPagoSDK.shared.getPublicKey()))
+
+        guard let url = components?.url else { return nil }
+
+        var request = URLRequest(url: url)
+        request.httpMethod = endpoint.method.rawValue
+        request.allHTTPHeaderFields = endpoint.headers
+        request.httpBody = endpoint.body
+        return request
+    }
 }
@@ -0,0 +1,142 @@
+//
+//  RequestSchedulerTests.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+@testable import MPCore
+import XCTest
+
+final class RequestSchedulerTests: XCTestCase {
+    func test_acquire_overLaneLimit_shouldWaitForRelease() async throws {
+        // Given
+        let sut = RequestScheduler(limits: .init(interactive: 1))
+        let events = EventLog()
+        try await sut.acquire(.interactive)
+
+        // When
+        let waiting = Task {
+            try await sut.run(.interactive) { await events.append("second") }
+        }
+        try await Task.sleep(nanoseconds: 50_000_000)
+        let beforeRelease = await events.entries
+
+        sut.release(.interactive)
+        try await waiting.value
+
+        // Then
+        let afterRelease = await events.entries
+        XCTAssertEqual(beforeRelease, [])
+        XCTAssertEqual(afterRelease, ["second"])
+    }
+
+    func test_background_whileCriticalRuns_shouldBeDeferred() async throws {
+        // Given
+        let sut = RequestScheduler()
+        let events = EventLog()
+        try await sut.acquire(.critical)
+
+        // When
+        let prefetch = Task {
+            try await sut.run(.background) { await events.append("background") }
+        }
+        try await sut.run(.interactive) { await events.append("interactive") }
+        try await Task.sleep(nanoseconds: 50_000_000)
+        await events.append("critical done")
+        sut.release(.critical)
+        try await prefetch.value
+
+        // Then
+        let entries = await events.entries
+        XCTAssertEqual(entries, ["interactive", "critical done", "background"])
+    }
+
+    func test_critical_whenBackgroundLaneIsFull_shouldRunImmediately() async throws {
+        // Given
+        let sut = RequestScheduler(limits: .init(background: 1))
+        try await sut.acquire(.background)
+        let queued = Task { try await sut.run(.background) {} }
+
+        // When
+        let value = try await sut.run(.critical) { "token" }
+
+        // Then
+        XCTAssertEqual(value, "token")
+        sut.release(.background)
+        try await queued.value
+    }
+
+    func test_acquire_whenCancelledWhileWaiting_shouldThrowAndLeaveLane() async throws {
+        // Given
+        let sut = RequestScheduler(limits: .init(interactive: 1))
+        try await sut.acquire(.interactive)
+        let waiting = Task { try await sut.acquire(.interactive) }
+        try await Task.sleep(nanoseconds: 20_000_000)
+
+        // When
+        waiting.cancel()
+
+        // Then
+        do {
+            try await waiting.value
+            XCTFail("Expected CancellationError")
+        } catch {
+            XCTAssertTrue(error is CancellationError)
+        }
+        sut.release(.interactive)
+        let value = try await sut.run(.interactive) { 1 }
+        XCTAssertEqual(value, 1)
+    }
+
+    func test_snapshot_shouldReportQueueingPerLane() async throws {
+        // Given
+        let sut = RequestScheduler(limits: .init(interactive: 1))
+        try await sut.acquire(.interactive)
+        let waiting = Task { try await sut.run(.interactive) {} }
+        try await Task.sleep(nanoseconds: 30_000_000)
+
+        // When
+        sut.release(.interactive)
+        try await waiting.value
+        let lanes = sut.snapshot()
+
+        // Then
+        XCTAssertEqual(lanes.map(\.priority), RequestPriority.allCases)
+        let interactive = try XCTUnwrap(lanes.first { $0.priority == .interactive })
+        XCTAssertEqual(interactive.requests, 2)
+        XCTAssertGreaterThanOrEqual(interactive.queueing.sum, 0.02)
+        XCTAssertEqual(lanes.first { $0.priority == .critical }?.requests, 0)
+    }
+
+    func test_run_whenMetricsEnabledMidFlight_shouldNotReportNegativeInFlight() async throws {
+        // Given
+        let metrics = MPMetrics()
+        let sut = RequestScheduler(metrics: metrics)
+        let started = Task {
+            try await sut.run(.interactive) { try await Task.sleep(nanoseconds: 50_000_000) }
+        }
+        try await Task.sleep(nanoseconds: 10_000_000)
+
+        // When
+        metrics.isEnabled = true
+        let inFlight = try await sut.run(.interactive) {
+            metrics.snapshot().gauges["network.requests_in_flight"]
+        }
+        try await started.value
+
+        // Then
+        XCTAssertEqual(inFlight, 2)
+        XCTAssertEqual(metrics.snapshot().gauges["network.requests_in_flight"], 0)
+    }
+}
+
+// MARK: - Helpers
+
+private actor EventLog {
+    private(set) var entries: [String] = []
+
+    func append(_ entry: String) {
+        entries.append(entry)
+    }
+}
@@ -0,0 +1,50 @@
+//
+//  RetryPolicyTests.swift
+//  MercadoPagoSDK-iOS
+//
+//  Created by Guilherme Prata Costa on 16/10/26.
+//
+
+@testable import MPCore
+import XCTest
+
+final class RetryPolicyTests: XCTestCase {
+    func test_delay_shouldGrowExponentiallyUpToMaximumDelay() {
+        let sut = RetryPolicy(maximumAttempts: 6, initialDelay: 1, maximumDelay: 5, multiplier: 2)
+
+        XCTAssertEqual(sut.delay(forRetry: 1, jitter: 1), 1)
+        XCTAssertEqual(sut.delay(forRetry: 2, jitter: 1), 2)
+        XCTAssertEqual(sut.delay(forRetry: 3, jitter: 1), 4)
+        XCTAssertEqual(sut.delay(forRetry: 4, jitter: 1), 5)
+        XCTAssertEqual(sut.delay(forRetry: 3, jitter: 0.5), 2)
+    }
+
+    func test_delay_withRetryAfter_shouldHonourServerHintWithinMaximumDelay() {
+        let sut = RetryPolicy(maximumDelay: 5)
+
+        XCTAssertEqual(sut.delay(forRetry: 1, retryAfter: 3), 3)
+        XCTAssertNil(sut.delay(forRetry: 1, retryAfter: 30))
+    }
+
+    func test_isRetryable_shouldClassifyTransientFailures() {
+        XCTAssertTrue(RetryPolicy.isRetryable(.networkError(URLError(.timedOut))))
+        XCTAssertTrue(RetryPolicy.isRetryable(.statusCode(503)))
+        XCTAssertTrue(RetryPolicy.isRetryable(statusCode: 429))
+        XCTAssertFalse(RetryPolicy.isRetryable(.networkError(URLError(.cancelled))))
+        XCTAssertFalse(RetryPolicy.isRetryable(.statusCode(501)))
+        XCTAssertFalse(RetryPolicy.isRetryable(statusCode: 404))
+        XCTAssertFalse(RetryPolicy.isRetryable(.invalidURL))
+    }
+
+    func test_budget_shouldRefillOnSuccess() {
+        let sut = RetryBudget(capacity: 1, depositPerSuccess: 0.5)
+
+        XCTAssertTrue(sut.withdraw())
+        XCTAssertFalse(sut.withdraw())
+
+        sut.deposit()
+        sut.deposit()
+
+        XCTAssertTrue(sut.withdraw())
+    }
+}
@@ -0,0 +1,25 @@
+#!/bin/bash
+
+# Builds MPBenchmarks in release for the iOS Simulator and runs it headless on a booted simulator.
+# Arguments are forwarded to MPBenchmarks; paths given to --save and --compare must be absolute.
+#
+#   scripts/run-benchmarks.sh --save "$PWD/benchmarks-baseline.json"
+#   scripts/run-benchmarks.sh --compare "$PWD/benchmarks-baseline.json" --threshold 10
+
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+SIMULATOR="${BENCHMARK_SIMULATOR:-iPhone 16}"
+SDK_PATH="$(xcrun --sdk iphonesimulator --show-sdk-path)"
+TRIPLE="$(uname -m)-apple-ios13.0-simulator"
+
+cd "$ROOT_DIR"
+
+swift build -c release --product MPBenchmarks --triple "$TRIPLE" --sdk "$SDK_PATH"
+BIN_PATH="$(swift build -c release --product MPBenchmarks --triple "$TRIPLE" --sdk "$SDK_PATH" --show-bin-path)"
+
+if ! xcrun simctl list devices booted | grep -q "$SIMULATOR"; then
+  xcrun simctl boot "$SIMULATOR"
+fi
+
+xcrun simctl spawn "$SIMULATOR" "$BIN_PATH/MPBenchmarks" "$@"